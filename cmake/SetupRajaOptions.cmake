@@ -13,6 +13,7 @@ option(RAJA_ENABLE_ROCTX "Build with ENABLE_ROCTX support" Off)
 
 option(RAJA_ENABLE_TARGET_OPENMP "Build OpenMP on target device support" Off)
 option(RAJA_ENABLE_SYCL "Build SYCL support" Off)
+option(RAJA_ENABLE_THREAD_POOL "Build std::thread pool back-end support" Off)
 
 option(RAJA_ENABLE_VECTORIZATION "Build experimental vectorization support" On)
 
@@ -30,6 +31,7 @@ option(RAJA_ENABLE_BOUNDS_CHECK "Enable bounds checking in RAJA::Views/Layouts"
 option(RAJA_TEST_EXHAUSTIVE "Build RAJA exhaustive tests" Off)
 option(RAJA_TEST_OPENMP_TARGET_SUBSET "Build subset of RAJA OpenMP target tests when it is enabled" On)
 option(RAJA_ENABLE_RUNTIME_PLUGINS "Enable support for loading plugins at runtime" Off)
+option(RAJA_ENABLE_PLUGIN_HOOKS "Call plugins from RAJA kernel execution methods, Off compiles the calls out" On)
 option(RAJA_ALLOW_INCONSISTENT_OPTIONS "Enable inconsistent values for ENABLE_X and RAJA_ENABLE_X options" Off)
 
 option(RAJA_ENABLE_DESUL_ATOMICS "Enable support of desul atomics" Off)
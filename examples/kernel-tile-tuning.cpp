@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "RAJA/RAJA.hpp"
+#include "RAJA/util/TileTuning.hpp"
+
+/*
+ *  Tile size tuning example
+ *
+ *  Finds the tile sizes of a tiled matrix transpose that uses tile_dynamic
+ *  for this machine, and stores them in a tuning database file.
+ *
+ *  Usage: kernel-tile-tuning [database file] [N]
+ *
+ *  When the program is run again with RAJA_TILE_TUNING_DB set to the
+ *  database file, tuned_tile_sizes returns the stored tile sizes.
+ */
+
+#if defined(RAJA_ENABLE_OPENMP)
+using outer_tile_pol = RAJA::omp_parallel_for_exec;
+#else
+using outer_tile_pol = RAJA::seq_exec;
+#endif
+
+using transpose_pol =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<1, RAJA::tile_dynamic<1>, outer_tile_pol,
+      RAJA::statement::Tile<0, RAJA::tile_dynamic<0>, RAJA::seq_exec,
+        RAJA::statement::For<1, RAJA::seq_exec,
+          RAJA::statement::For<0, RAJA::seq_exec,
+            RAJA::statement::Lambda<0, RAJA::Segs<0, 1>>
+          >
+        >
+      >
+    >
+  >;
+
+int main(int argc, char **argv)
+{
+  std::cout << "\n\nRAJA tile size tuning example...\n\n";
+
+  const std::string db_file = argc > 1 ? argv[1] : "tile_tuning.db";
+  const int N = argc > 2 ? std::atoi(argv[2]) : 2048;
+
+  std::vector<double> A(N * N, 1.0);
+  std::vector<double> At(N * N, 0.0);
+  double* a = A.data();
+  double* at = At.data();
+
+  auto segs = RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, N),
+                               RAJA::TypedRangeSegment<int>(0, N));
+
+  auto transpose = [=](camp::tuple<RAJA::TileSize, RAJA::TileSize> tiles) {
+    RAJA::kernel_param<transpose_pol>(segs, tiles,
+      [=](int col, int row) {
+        at[col * N + row] = a[row * N + col];
+      });
+  };
+
+  //
+  // Tuned tile sizes, or the defaults if there are none yet
+  //
+  auto default_tiles = RAJA::util::tuned_tile_sizes("transpose", {N, N}, 32, 32);
+  std::cout << "Tile sizes before tuning: " << camp::get<0>(default_tiles).size
+            << " x " << camp::get<1>(default_tiles).size << std::endl;
+
+  //
+  // Sweep the tile sizes and store the fastest in the database
+  //
+  const RAJA::util::TileTuningDatabase::Sizes candidates{8, 16, 32, 64, 128, 256};
+  auto tiles = RAJA::util::tune_tile_sizes(
+      "transpose", {N, N},
+      std::array<RAJA::util::TileTuningDatabase::Sizes, 2>{{candidates, candidates}},
+      transpose);
+
+  std::cout << "Tuned tile sizes: " << camp::get<0>(tiles).size
+            << " x " << camp::get<1>(tiles).size << std::endl;
+
+  if (RAJA::util::TileTuningDatabase::instance().save(db_file)) {
+    std::cout << "Tuning database written to " << db_file << std::endl;
+  }
+
+  transpose(tiles);
+
+  std::cout << "\n DONE!...\n";
+
+  return 0;
+}
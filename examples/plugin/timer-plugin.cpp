@@ -23,13 +23,17 @@ public:
     end_time = std::chrono::steady_clock::now();
     double elapsedMs = std::chrono::duration<double, std::milli>(end_time - start_time).count();
 
+    const char* name = p.kernel_name != nullptr ? p.kernel_name : "unnamed";
+
     if (p.platform == RAJA::Platform::host)
     {
-      printf("[TimerPlugin]: Elapsed time of host kernel was %f ms\n", elapsedMs);
+      printf("[TimerPlugin]: Elapsed time of host kernel %s (%zu iterations) was %f ms\n",
+             name, p.num_iterations, elapsedMs);
     }
     else
     {
-      printf("[TimerPlugin]: Elapsed time of device kernel was %f ms\n", elapsedMs);
+      printf("[TimerPlugin]: Elapsed time of device kernel %s (%zu iterations) was %f ms\n",
+             name, p.num_iterations, elapsedMs);
     }
   }
 
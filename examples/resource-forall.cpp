@@ -28,6 +28,7 @@
  *    -  `forall` with Resource argument
  *    -  Cuda/Hip streams w/ Resource
  *    -  Resources events
+ *    -  Asynchronous host resource
  *
  */
 
@@ -149,6 +150,22 @@ int main(int RAJA_UNUSED_ARG(argc), char **RAJA_UNUSED_ARG(argv[]))
   checkResult(c, N);
 #endif
 
+//----------------------------------------------------------------------------//
+
+  std::cout << "\n Running RAJA vector addition on an async host resource...\n";
+
+  RAJA::resources::HostAsync host_async;
+
+  RAJA::resources::Event e_async =
+    RAJA::forall<RAJA::seq_exec>(host_async, RAJA::RangeSegment(0, N),
+  [=] (int i) {
+    c[i] = a[i] + b[i]; 
+  });
+
+  e_async.wait();
+
+  checkResult(c, N);
+
 
 
 #if defined(RAJA_ENABLE_CUDA) || defined(RAJA_ENABLE_HIP) || defined(RAJA_ENABLE_SYCL)
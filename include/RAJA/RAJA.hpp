@@ -85,6 +85,10 @@
 #endif
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+#include "RAJA/policy/thread_pool.hpp"
+#endif
+
 #if defined(RAJA_ENABLE_DESUL_ATOMICS)
     #include "RAJA/policy/desul.hpp"
 #endif
@@ -102,6 +106,7 @@
 // in the files included below.
 //
 #include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/forall_fused.hpp"
 #include "RAJA/pattern/region.hpp"
 
 #include "RAJA/policy/MultiPolicy.hpp"
@@ -165,6 +170,11 @@
 //
 #include "RAJA/pattern/synchronize.hpp"
 
+//
+// Asynchronous host resource
+//
+#include "RAJA/util/HostAsync.hpp"
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -183,7 +193,7 @@
 
 #include "RAJA/pattern/scan.hpp"
 
-#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
 #include "RAJA/util/PluginLinker.hpp"
 #endif
 
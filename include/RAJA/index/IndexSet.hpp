@@ -20,9 +20,12 @@
 
 #include "RAJA/config.hpp"
 
+#include <memory>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
@@ -491,10 +494,20 @@ public:
   //! Set [begin, end) interval of segments identified by interval_id
   void setSegmentInterval(size_t interval_id, int begin, int end)
   {
+    if (interval_id >= m_seg_interval_begin.size()) {
+      m_seg_interval_begin.resize(interval_id + 1, 0);
+      m_seg_interval_end.resize(interval_id + 1, 0);
+    }
     m_seg_interval_begin[interval_id] = begin;
     m_seg_interval_end[interval_id] = end;
   }
 
+  //! get number of segment intervals that have been set
+  size_t getNumSegmentIntervals() const
+  {
+    return m_seg_interval_begin.size();
+  }
+
   //! get lower bound of segment identified with interval_id
   int getSegmentIntervalBegin(size_t interval_id) const
   {
@@ -609,6 +622,13 @@ public:
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    if (c.m_dep_graph) {
+      m_dep_graph_size = c.m_dep_graph_size;
+      m_dep_graph.reset(new DepGraphNode[m_dep_graph_size]);
+      for (size_t i = 0; i < m_dep_graph_size; ++i) {
+        m_dep_graph[i] = c.m_dep_graph[i];
+      }
+    }
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,6 +639,52 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
+    swap(m_dep_graph_size, other.m_dep_graph_size);
+  }
+
+  ///
+  /// Allocate a dependency graph node for each segment currently in the
+  /// index set, replacing any existing graph. Nodes start with no
+  /// dependencies and must be set up before calling
+  /// finalizeDependencyGraph().
+  ///
+  void initDependencyGraph()
+  {
+    m_dep_graph_size = segment_types.size();
+    m_dep_graph.reset(new DepGraphNode[m_dep_graph_size]);
+  }
+
+  ///
+  /// Check that every forward dependency names a segment in the graph.
+  ///
+  void finalizeDependencyGraph()
+  {
+    for (size_t i = 0; i < m_dep_graph_size; ++i) {
+      DepGraphNode &task = m_dep_graph[i];
+      for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+        int seg = task.depTaskNum(ii);
+        if (seg < 0 || static_cast<size_t>(seg) >= m_dep_graph_size) {
+          RAJA_ABORT_OR_THROW("IndexSet dependency graph names an invalid segment");
+        }
+      }
+    }
+  }
+
+  //! Returns true if a dependency graph has been set for the index set.
+  bool dependencyGraphSet() const
+  {
+    return m_dep_graph != nullptr && m_dep_graph_size == segment_types.size();
+  }
+
+  ///
+  /// Get the dependency graph node of the given segment. Executing the
+  /// graph updates node state, so nodes are mutable through a const
+  /// index set.
+  ///
+  DepGraphNode *getDepGraphNode(size_t segid) const
+  {
+    return &m_dep_graph[segid];
   }
 
 protected:
@@ -754,6 +820,12 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! Dependency graph nodes:    seg_index -> node
+  std::unique_ptr<DepGraphNode[]> m_dep_graph;
+
+  //! Number of nodes in the dependency graph
+  size_t m_dep_graph_size = 0;
 };
 
 
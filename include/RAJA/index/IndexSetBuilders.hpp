@@ -83,6 +83,8 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
  *
  *        The method chunks a fastDim x midDim x slowDim mesh into blocks that 
  *        can be dependency-scheduled, removing need for lock constructs.
+ *        For 3d meshes the index set carries a segment dependency graph
+ *        and should be executed with omp_taskgraph_segit.
  *
  *  \param iset reference to index set generated with range segments.
  *         Method assumes index set is empty (no segments). 
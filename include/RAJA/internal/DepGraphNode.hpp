@@ -22,10 +22,22 @@
 #include "RAJA/config.hpp"
 
 #include <atomic>
-#include <cstdlib>
+#include <climits>
+#include <cstddef>
 #include <iosfwd>
+#include <new>
 #include <thread>
+#include <vector>
 
+#if !defined(__cpp_lib_atomic_wait) && defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
 namespace RAJA
@@ -37,29 +49,66 @@ namespace RAJA
  * \brief  Class defining a simple semephore-based data structure for
  *         managing a node in a dependency graph.
  *
+ *         Threads waiting on a node spin briefly and then block on the
+ *         semaphore (std::atomic wait when available, a futex on Linux)
+ *         until the last incoming dependency is satisfied.
+ *
  ******************************************************************************
  */
 class RAJA_ALIGNED_ATTR(256) DepGraphNode
 {
 public:
   ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
+  /// Number of times wait() polls the semaphore before blocking.
   ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
+  /// This value may need to be set differently for different
+  /// algorithms and platforms. We haven't determined the best default yet!
   ///
-  static const int _MaxDepTasks_ = 8;
+  static const int _WaitSpinCount_ = 1024;
 
   ///
   /// Default ctor initializes node to default state.
   ///
   DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
+      : m_num_dep_tasks(0),
+        m_semaphore_reload_value(0),
+        m_semaphore_value(0),
+        m_num_waiters(0)
   {
   }
 
+  ///
+  /// Copy ctor copies the graph data and current semaphore value.
+  ///
+  DepGraphNode(const DepGraphNode& other)
+      : m_dep_task(other.m_dep_task),
+        m_num_dep_tasks(other.m_num_dep_tasks),
+        m_semaphore_reload_value(other.m_semaphore_reload_value),
+        m_semaphore_value(other.m_semaphore_value.load()),
+        m_num_waiters(0)
+  {
+  }
+
+  ///
+  /// Copy-assignment copies the graph data and current semaphore value.
+  ///
+  DepGraphNode& operator=(const DepGraphNode& other)
+  {
+    m_dep_task = other.m_dep_task;
+    m_num_dep_tasks = other.m_num_dep_tasks;
+    m_semaphore_reload_value = other.m_semaphore_reload_value;
+    m_semaphore_value.store(other.m_semaphore_value.load());
+    return *this;
+  }
+
+  ///
+  /// Nodes are over-aligned, allocate them with aligned storage.
+  ///
+  static void* operator new(size_t size) { return allocate(size); }
+  static void* operator new[](size_t size) { return allocate(size); }
+  static void operator delete(void* ptr) { free_aligned(ptr); }
+  static void operator delete[](void* ptr) { free_aligned(ptr); }
+
   ///
   /// Get/set semaphore value; i.e., the current number of (unsatisfied)
   /// dependencies that must be satisfied before this task can execute.
@@ -78,13 +127,24 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency, waking any threads waiting on this
+  /// task if it was the last one. Returns true if it was the last one.
   ///
-  void satisfyOne()
+  bool satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
+    int value = m_semaphore_value.load(std::memory_order_relaxed);
+    while (value > 0 &&
+           !m_semaphore_value.compare_exchange_weak(value, value - 1)) {
     }
+
+    if (value != 1) {
+      return false;
+    }
+
+    if (m_num_waiters.load() > 0) {
+      notifyAll();
+    }
+    return true;
   }
 
   ///
@@ -92,11 +152,18 @@ public:
   ///
   void wait()
   {
-    while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
-      std::this_thread::yield();
+    for (int spin = 0; spin < _WaitSpinCount_; ++spin) {
+      if (m_semaphore_value.load(std::memory_order_acquire) <= 0) {
+        return;
+      }
+    }
+
+    m_num_waiters.fetch_add(1);
+    int value;
+    while ((value = m_semaphore_value.load()) > 0) {
+      waitWhileEqual(value);
     }
+    m_num_waiters.fetch_sub(1);
   }
 
   ///
@@ -110,7 +177,19 @@ public:
   /// index for this task. This is used to notify the appropriate external
   /// dependencies when this task completes.
   ///
-  int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
+  int& depTaskNum(int tidx)
+  {
+    if (static_cast<size_t>(tidx) >= m_dep_task.size()) {
+      m_dep_task.resize(tidx + 1, -1);
+    }
+    return m_dep_task[tidx];
+  }
+
+  ///
+  /// Get the forward dependency task number associated with the given
+  /// index for this task.
+  ///
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
 
   ///
   /// Print task graph object node data to given output stream.
@@ -118,10 +197,59 @@ public:
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
+  static void* allocate(size_t size)
+  {
+    void* ptr = allocate_aligned(alignof(DepGraphNode), size);
+    if (ptr == nullptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  ///
+  /// Block while the semaphore holds value, may return spuriously.
+  ///
+  void waitWhileEqual(int value)
+  {
+#if defined(__cpp_lib_atomic_wait)
+    m_semaphore_value.wait(value);
+#elif defined(__linux__)
+    syscall(SYS_futex,
+            reinterpret_cast<int*>(&m_semaphore_value),
+            FUTEX_WAIT_PRIVATE,
+            value,
+            nullptr,
+            nullptr,
+            0);
+#else
+    RAJA_UNUSED_VAR(value);
+    std::this_thread::yield();
+#endif
+  }
+
+  ///
+  /// Wake all threads blocked in waitWhileEqual.
+  ///
+  void notifyAll()
+  {
+#if defined(__cpp_lib_atomic_wait)
+    m_semaphore_value.notify_all();
+#elif defined(__linux__)
+    syscall(SYS_futex,
+            reinterpret_cast<int*>(&m_semaphore_value),
+            FUTEX_WAKE_PRIVATE,
+            INT_MAX,
+            nullptr,
+            nullptr,
+            0);
+#endif
+  }
+
+  std::vector<int> m_dep_task;
   int m_num_dep_tasks;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
+  std::atomic<int> m_num_waiters;
 };
 
 }  // namespace RAJA
@@ -23,6 +23,7 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 
 #include "RAJA/util/types.hpp"
@@ -121,6 +122,92 @@ struct FreeAlignedType : FreeAligned
   }
 };
 
+///
+/// Scratch memory for the calling thread, drawn from a buffer that each
+/// thread keeps across uses and grows only when a larger size is needed.
+/// The buffer is aligned to RAJA::DATA_ALIGN and first touched by its
+/// thread, so it is placed in that thread's NUMA domain.
+///
+/// If the thread's buffer is already in use, e.g. by an enclosing launch,
+/// separate memory is allocated and freed for this use.
+///
+class ThreadScratch
+{
+public:
+  explicit ThreadScratch(size_t size) : m_buffer(get_thread_buffer())
+  {
+    if (!m_buffer.in_use) {
+      m_buffer.reserve(size);
+      m_buffer.in_use = true;
+      m_ptr = m_buffer.ptr;
+      m_owns_buffer = true;
+    } else if (size > 0) {
+      m_ptr = allocate_aligned(DATA_ALIGN, round_up(size));
+    }
+  }
+
+  ThreadScratch(ThreadScratch const&) = delete;
+  ThreadScratch& operator=(ThreadScratch const&) = delete;
+
+  ~ThreadScratch()
+  {
+    if (m_owns_buffer) {
+      m_buffer.in_use = false;
+    } else if (m_ptr != nullptr) {
+      free_aligned(m_ptr);
+    }
+  }
+
+  void* get() const { return m_ptr; }
+
+private:
+  struct buffer {
+    void* ptr = nullptr;
+    size_t size = 0;
+    bool in_use = false;
+
+    ~buffer()
+    {
+      if (ptr != nullptr) {
+        free_aligned(ptr);
+      }
+    }
+
+    void reserve(size_t new_size)
+    {
+      if (new_size > size) {
+        if (ptr != nullptr) {
+          free_aligned(ptr);
+        }
+        // grow geometrically so slowly increasing sizes reallocate rarely
+        size = round_up(new_size > 2 * size ? new_size : 2 * size);
+        ptr = allocate_aligned(DATA_ALIGN, size);
+        if (ptr == nullptr) {
+          size = 0;
+        } else {
+          // first touch on this thread
+          std::memset(ptr, 0, size);
+        }
+      }
+    }
+  };
+
+  static size_t round_up(size_t size)
+  {
+    return (size + DATA_ALIGN - 1) / DATA_ALIGN * DATA_ALIGN;
+  }
+
+  static buffer& get_thread_buffer()
+  {
+    static thread_local buffer t_buffer;
+    return t_buffer;
+  }
+
+  buffer& m_buffer;
+  void* m_ptr = nullptr;
+  bool m_owns_buffer = false;
+};
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <iterator>
+
 #include "RAJA/pattern/WorkGroup/WorkStorage.hpp"
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
@@ -257,18 +259,25 @@ public:
   template < typename segment_T, typename loop_T >
   inline void enqueue(segment_T&& seg, loop_T&& loop_body)
   {
+    size_t num_iterations = 0;
     {
       // ignore zero length loops
       using std::begin; using std::end;
       if (begin(seg) == end(seg)) return;
+      num_iterations = static_cast<size_t>(std::distance(begin(seg), end(seg)));
     }
     if (m_storage.begin() == m_storage.end()) {
       // perform auto-reserve on reuse
       reserve(m_max_num_loops, m_max_storage_bytes);
+      m_num_iterations = 0;
     }
+    m_num_iterations += num_iterations;
 
-    util::PluginContext context{util::make_context<exec_policy>()};
-    util::callPreCapturePlugins(context);
+    const bool use_plugins = util::plugins_active();
+    util::PluginContext context{use_plugins ?
+        util::make_context<exec_policy, camp::decay<loop_T>>(nullptr, num_iterations)
+        : util::PluginContext{Platform::undefined}};
+    if (use_plugins) { util::callPreCapturePlugins(context); }
 
     using RAJA::util::trigger_updates_before;
     auto body = trigger_updates_before(loop_body);
@@ -276,7 +285,7 @@ public:
     m_runner.enqueue(
         m_storage, std::forward<segment_T>(seg), std::move(body));
 
-    util::callPostCapturePlugins(context);
+    if (use_plugins) { util::callPostCapturePlugins(context); }
   }
 
   inline workgroup_type instantiate();
@@ -287,6 +296,7 @@ public:
     // but it was never used so no synchronization necessary
     m_storage.clear();
     m_runner.clear();
+    m_num_iterations = 0;
   }
 
   ~WorkPool()
@@ -298,6 +308,8 @@ private:
   storage_type m_storage;
   size_t m_max_num_loops = 0;
   size_t m_max_storage_bytes = 0;
+  // iterations in the enqueued loops, reported to plugins
+  size_t m_num_iterations = 0;
 
   workrunner_type m_runner;
 };
@@ -358,6 +370,7 @@ public:
     // TODO: synchronize
     m_storage.clear();
     m_runner.clear();
+    m_num_iterations = 0;
   }
 
   ~WorkGroup()
@@ -368,10 +381,13 @@ public:
 private:
   storage_type m_storage;
   workrunner_type m_runner;
+  size_t m_num_iterations;
 
-  WorkGroup(storage_type&& storage, workrunner_type&& runner)
+  WorkGroup(storage_type&& storage, workrunner_type&& runner,
+            size_t num_iterations)
     : m_storage(std::move(storage))
     , m_runner(std::move(runner))
+    , m_num_iterations(num_iterations)
   { }
 };
 
@@ -469,7 +485,8 @@ WorkPool<
   m_max_storage_bytes = std::max(m_storage.storage_size(), m_max_storage_bytes);
 
   // move storage into workgroup
-  return workgroup_type{std::move(m_storage), std::move(m_runner)};
+  return workgroup_type{std::move(m_storage), std::move(m_runner),
+                        m_num_iterations};
 }
 
 template <typename EXEC_POLICY_T,
@@ -496,13 +513,16 @@ WorkGroup<
                           ALLOCATOR_T>::resource_type r,
                       Args... args)
 {
-  util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
-  util::callPreLaunchPlugins(context);
+  const bool use_plugins = util::plugins_active();
+  util::PluginContext context{use_plugins ?
+      util::make_context<EXEC_POLICY_T, WorkGroup>(nullptr, m_num_iterations)
+      : util::PluginContext{Platform::undefined}};
+  if (use_plugins) { util::callPreLaunchPlugins(context); }
 
   // move any per run storage into worksite
   worksite_type site(r, m_runner.run(m_storage, r, std::forward<Args>(args)...));
 
-  util::callPostLaunchPlugins(context);
+  if (use_plugins) { util::callPostLaunchPlugins(context); }
 
   return site;
 }
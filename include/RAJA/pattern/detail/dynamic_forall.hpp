@@ -0,0 +1,204 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief  Internal header with the policy tuning state used by
+ *         RAJA::expt::dynamic_forall in auto mode
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_PATTERN_DETAIL_DYNAMIC_FORALL_HPP
+#define RAJA_PATTERN_DETAIL_DYNAMIC_FORALL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace RAJA
+{
+namespace expt
+{
+
+/*!
+ * Policy value that makes dynamic_forall choose the policy itself
+ */
+constexpr int dynamic_auto = -1;
+
+/*!
+ * Settings of the dynamic_forall policy tuner, shared by all call sites
+ */
+struct DynamicTuningOptions {
+  //! number of timed runs of each policy before the fastest one is pinned
+  int probe_samples = 3;
+  //! a pinned call site retimes one other policy every reprobe_interval
+  //! runs, 0 turns this off
+  long reprobe_interval = 1024;
+};
+
+inline DynamicTuningOptions& dynamic_tuning_options()
+{
+  static DynamicTuningOptions options;
+  return options;
+}
+
+namespace detail
+{
+
+//! Segment lengths are tuned separately by their power of two
+constexpr int dynamic_tuning_num_buckets = 64;
+
+inline int dynamic_tuning_bucket(size_t len)
+{
+  int bucket = 0;
+  while (len >>= 1) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+/*!
+ * Timings and chosen policy of one call site and segment length bucket.
+ * The chosen policy is read without locking; timings are recorded under
+ * the mutex, which is only taken by timed runs.
+ */
+template <int N>
+struct DynamicTuningBucket {
+  std::atomic<int> best{-1};
+  std::atomic<unsigned long long> calls{0};
+
+  std::mutex mutex;
+  double seconds_per_iteration[N] = {};
+  int samples[N] = {};
+  int next_candidate = 0;
+
+  struct Choice {
+    int pol;
+    bool timed;
+  };
+
+  Choice choose()
+  {
+    const unsigned long long call = calls.fetch_add(1, std::memory_order_relaxed);
+    const int pinned = best.load(std::memory_order_acquire);
+
+    // time every policy in turn until all have enough samples
+    if (pinned < 0) {
+      return {static_cast<int>(call % N), true};
+    }
+
+    // time another policy, then the pinned one, every reprobe_interval runs
+    const long interval = dynamic_tuning_options().reprobe_interval;
+    if (N == 1 || interval <= 0) {
+      return {pinned, false};
+    }
+    const unsigned long long phase = call % static_cast<unsigned long long>(interval);
+    if (phase == 0) {
+      std::lock_guard<std::mutex> lock(mutex);
+      next_candidate = (next_candidate + 1) % N;
+      if (next_candidate == pinned) {
+        next_candidate = (next_candidate + 1) % N;
+      }
+      return {next_candidate, true};
+    }
+    return {pinned, phase == 1};
+  }
+
+  void record(int pol, double seconds, size_t num_iterations)
+  {
+    const double t = seconds / static_cast<double>(num_iterations > 0 ? num_iterations : 1);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const int pinned = best.load(std::memory_order_relaxed);
+    if (samples[pol] == 0) {
+      seconds_per_iteration[pol] = t;
+    } else if (pinned < 0) {
+      // fastest run while probing, later runs see warm caches
+      if (t < seconds_per_iteration[pol]) {
+        seconds_per_iteration[pol] = t;
+      }
+    } else {
+      // recent runs once pinned, to follow changes in the machine load
+      seconds_per_iteration[pol] = 0.5 * (seconds_per_iteration[pol] + t);
+    }
+    ++samples[pol];
+
+    if (pinned < 0) {
+      const int probe_samples = dynamic_tuning_options().probe_samples;
+      int fastest = 0;
+      for (int p = 0; p < N; ++p) {
+        if (samples[p] < probe_samples) {
+          return;
+        }
+        if (seconds_per_iteration[p] < seconds_per_iteration[fastest]) {
+          fastest = p;
+        }
+      }
+      best.store(fastest, std::memory_order_release);
+    } else if (pol != pinned &&
+               seconds_per_iteration[pol] < seconds_per_iteration[pinned]) {
+      best.store(pol, std::memory_order_release);
+    }
+  }
+};
+
+template <int N>
+struct DynamicTuningTable {
+  DynamicTuningBucket<N> buckets[dynamic_tuning_num_buckets];
+};
+
+/*!
+ * Tuning table of a call site. Lambda types are unique to their call site,
+ * so each dynamic_forall call gets its own table.
+ */
+template <int N, typename POLICY_LIST, typename BODY>
+DynamicTuningTable<N>& dynamic_tuning_table()
+{
+  static DynamicTuningTable<N> table;
+  return table;
+}
+
+/*!
+ * Run invoke(pol) with the policy chosen for a segment of length len,
+ * timing it and recording the time when the tuner asks for it.
+ * finish() is called before the end time is taken.
+ */
+template <int N, typename POLICY_LIST, typename BODY,
+          typename Invoke, typename Finish>
+void dynamic_tuned_invoke(size_t len, Invoke&& invoke, Finish&& finish)
+{
+  auto& bucket =
+      dynamic_tuning_table<N, POLICY_LIST, BODY>().buckets[dynamic_tuning_bucket(len)];
+
+  const auto choice = bucket.choose();
+  if (!choice.timed) {
+    invoke(choice.pol);
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  invoke(choice.pol);
+  finish();
+  const auto stop = std::chrono::steady_clock::now();
+
+  bucket.record(choice.pol,
+                std::chrono::duration<double>(stop - start).count(),
+                len);
+}
+
+}  // namespace detail
+
+}  // namespace expt
+}  // namespace RAJA
+
+#endif /* RAJA_PATTERN_DETAIL_DYNAMIC_FORALL_HPP */
@@ -76,6 +76,7 @@
 #include "RAJA/policy/sequential/forall.hpp"
 
 #include "RAJA/pattern/detail/forall.hpp"
+#include "RAJA/pattern/detail/dynamic_forall.hpp"
 #include "RAJA/pattern/detail/privatizer.hpp"
 
 #include "RAJA/internal/get_platform.hpp"
@@ -119,6 +120,21 @@ struct icount_adapter {
   }
 };
 
+/// Number of iterations in a container, reported to plugins
+template <typename Container>
+RAJA_INLINE size_t plugin_iteration_count(Container const& c)
+{
+  using std::begin;
+  using std::end;
+  return static_cast<size_t>(std::distance(begin(c), end(c)));
+}
+///
+template <typename... SegmentTypes>
+RAJA_INLINE size_t plugin_iteration_count(TypedIndexSet<SegmentTypes...> const& c)
+{
+  return c.getLength();
+}
+
 struct CallForall {
   template <typename T, typename ExecPol, typename Body, typename Res, typename ForallParams>
   RAJA_INLINE camp::resources::EventProxy<Res> operator()(T const&, ExecPol, Body, Res, ForallParams) const;
@@ -304,14 +320,29 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
+  // read before the params are forwarded
+  const char* kernel_name = expt::detail::get_kernel_name(params...);
   auto f_params = expt::make_forall_param_pack(std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   //expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using RAJA::util::trigger_updates_before;
+
+  if (!util::plugins_active()) {
+    return wrap::forall_Icount(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<IdxSet>(c),
+        trigger_updates_before(loop_body),
+        f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<decltype(loop_body)>>(
+          kernel_name,
+          detail::plugin_iteration_count(c))};
   util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
 
   util::callPostCapturePlugins(context);
@@ -359,14 +390,29 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, Params&&... params)
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
+  // read before the params are forwarded
+  const char* kernel_name = expt::detail::get_kernel_name(params...);
   auto f_params = expt::make_forall_param_pack(std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using RAJA::util::trigger_updates_before;
+
+  if (!util::plugins_active()) {
+    return wrap::forall(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<IdxSet>(c),
+        trigger_updates_before(loop_body),
+        f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<decltype(loop_body)>>(
+          kernel_name,
+          detail::plugin_iteration_count(c))};
   util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
 
   util::callPostCapturePlugins(context);
@@ -452,14 +498,30 @@ forall_Icount(ExecutionPolicy&& p,
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
+  // read before the params are forwarded
+  const char* kernel_name = expt::detail::get_kernel_name(first, params...);
   auto f_params = expt::make_forall_param_pack(std::forward<FirstParam>(first), std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<FirstParam>(first), std::forward<Params>(params)...);
   //expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using RAJA::util::trigger_updates_before;
+
+  if (!util::plugins_active()) {
+    return wrap::forall_Icount(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<Container>(c),
+        icount,
+        trigger_updates_before(loop_body),
+        f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<decltype(loop_body)>>(
+          kernel_name,
+          detail::plugin_iteration_count(c))};
   util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
 
   util::callPostCapturePlugins(context);
@@ -520,14 +582,29 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, Params&&... params)
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
+  // read before the params are forwarded
+  const char* kernel_name = expt::detail::get_kernel_name(params...);
   auto f_params = expt::make_forall_param_pack(std::forward<Params>(params)...);
   auto&& loop_body = expt::get_lambda(std::forward<Params>(params)...);
   expt::check_forall_optional_args(loop_body, f_params);
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  using RAJA::util::trigger_updates_before;
+
+  if (!util::plugins_active()) {
+    return wrap::forall(
+        r,
+        std::forward<ExecutionPolicy>(p),
+        std::forward<Container>(c),
+        trigger_updates_before(loop_body),
+        f_params);
+  }
+
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<decltype(loop_body)>>(
+          kernel_name,
+          detail::plugin_iteration_count(c))};
   util::callPreCapturePlugins(context);
 
-  using RAJA::util::trigger_updates_before;
   auto body = trigger_updates_before(loop_body);
 
   util::callPostCapturePlugins(context);
@@ -718,12 +795,28 @@ namespace expt
 
   };
 
+  //
+  // With pol == dynamic_auto the policy is chosen separately for each call
+  // site and power of two of the segment length: every policy is timed
+  // probe_samples times, then the fastest one is used and the others are
+  // retimed now and then (see dynamic_tuning_options()).
+  //
   template<typename POLICY_LIST, typename SEGMENT, typename BODY>
   void dynamic_forall(const int pol, SEGMENT const &seg, BODY const &body)
   {
     constexpr int N = camp::size<POLICY_LIST>::value;
     static_assert(N > 0, "RAJA policy list must not be empty");
 
+    if(pol == dynamic_auto) {
+      detail::dynamic_tuned_invoke<N, POLICY_LIST, BODY>(
+          RAJA::detail::plugin_iteration_count(seg),
+          [&](int tuned_pol) {
+            dynamic_helper<N-1, POLICY_LIST>::invoke_forall(tuned_pol, seg, body);
+          },
+          [](){});
+      return;
+    }
+
     if(pol > N-1)  {
       RAJA_ABORT_OR_THROW("Policy enum not supported");
     }
@@ -737,6 +830,17 @@ namespace expt
     constexpr int N = camp::size<POLICY_LIST>::value;
     static_assert(N > 0, "RAJA policy list must not be empty");
 
+    if(pol == dynamic_auto) {
+      // timed runs wait for the kernel so that the time covers all of it
+      detail::dynamic_tuned_invoke<N, POLICY_LIST, BODY>(
+          RAJA::detail::plugin_iteration_count(seg),
+          [&](int tuned_pol) {
+            dynamic_helper<N-1, POLICY_LIST>::invoke_forall(r, tuned_pol, seg, body);
+          },
+          [&](){ r.wait(); });
+      return {r};
+    }
+
     if(pol > N-1)  {
       RAJA_ABORT_OR_THROW("Policy value out of range");
     }
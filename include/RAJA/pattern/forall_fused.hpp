@@ -0,0 +1,480 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA fused forall API call
+ *
+ *             \code
+ *
+ *             forall_fused<exec_policy>( segment, loop body 1, loop body 2 );
+ *
+ *             \endcode
+ *
+ *          which runs several loop bodies over the same segment in one
+ *          parallel loop, optionally strip-mined so that each strip of
+ *          the segment goes through all of the bodies while its data is
+ *          still in cache.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_fused_HPP
+#define RAJA_forall_fused_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+#include "camp/concepts.hpp"
+
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * \brief Strip length for forall_fused. Each strip of this many iterations
+ *        is run through every loop body before the next strip starts.
+ */
+struct StripMine {
+  Index_type size;
+};
+
+RAJA_INLINE StripMine strip_mine(Index_type size)
+{
+  return StripMine{size > 0 ? size : 1};
+}
+
+/*!
+ * \brief Strip length whose data fills about half of a cache of
+ *        cache_bytes, the default being a 256 KiB L2 cache, when each
+ *        iteration of all of the fused bodies together touches
+ *        bytes_per_iteration bytes.
+ */
+RAJA_INLINE StripMine strip_mine_for_cache(size_t bytes_per_iteration,
+                                           size_t cache_bytes = 256 * 1024)
+{
+  const size_t bytes = bytes_per_iteration > 0 ? bytes_per_iteration : 1;
+  return strip_mine(static_cast<Index_type>(cache_bytes / 2 / bytes));
+}
+
+namespace detail
+{
+
+template <typename Params, typename Body>
+struct FusedBody;
+
+/*!
+ * Loop body of forall_fused with its own expt parameters (reducers,
+ * kernel name). The body is called with the index followed by the
+ * arguments of its own parameters only.
+ */
+template <typename... Params, typename Body>
+struct FusedBody<camp::tuple<Params...>, Body> {
+  camp::tuple<Params...> params;
+  Body body;
+};
+
+//! Number of lambda arguments of a list of expt parameters
+template <typename... Params>
+struct fused_num_args : camp::num<0> {
+};
+
+template <typename First, typename... Rest>
+struct fused_num_args<First, Rest...>
+    : camp::num<camp::tuple_size<typename First::ARG_TUP_T>::value +
+                fused_num_args<Rest...>::value> {
+};
+
+template <typename T>
+struct fused_body_traits {
+  static constexpr bool is_fused_body = false;
+  using params = camp::tuple<>;
+  static constexpr camp::idx_t num_args = 0;
+};
+
+template <typename... Params, typename Body>
+struct fused_body_traits<FusedBody<camp::tuple<Params...>, Body>> {
+  static constexpr bool is_fused_body = true;
+  using params = camp::tuple<Params...>;
+  static constexpr camp::idx_t num_args = fused_num_args<Params...>::value;
+};
+
+//! Plain loop bodies are fused bodies without parameters
+template <typename Body>
+RAJA_INLINE concepts::enable_if_t<
+    FusedBody<camp::tuple<>, camp::decay<Body>>,
+    concepts::negate<std::integral_constant<
+        bool,
+        fused_body_traits<camp::decay<Body>>::is_fused_body>>>
+make_fused_body(Body&& body)
+{
+  return FusedBody<camp::tuple<>, camp::decay<Body>>{
+      camp::tuple<>{}, std::forward<Body>(body)};
+}
+
+template <typename... Params, typename Body>
+RAJA_INLINE FusedBody<camp::tuple<Params...>, Body> make_fused_body(
+    FusedBody<camp::tuple<Params...>, Body> const& body)
+{
+  return body;
+}
+
+template <camp::idx_t... Seq, typename... Args>
+RAJA_INLINE auto fused_body_from_args(camp::idx_seq<Seq...>,
+                                      camp::tuple<Args...>&& args)
+    -> FusedBody<camp::tuple<camp::decay<decltype(camp::get<Seq>(args))>...>,
+                 camp::decay<decltype(camp::get<sizeof...(Args) - 1>(args))>>
+{
+  return {camp::make_tuple(camp::get<Seq>(args)...),
+          camp::get<sizeof...(Args) - 1>(args)};
+}
+
+/*!
+ * Calls the fused bodies. Body K gets the lambda arguments of the
+ * combined parameter pack starting at the sum of the argument counts of
+ * the bodies before it.
+ */
+template <typename... Bodies>
+struct FusedBodies {
+  static constexpr camp::idx_t num_bodies = sizeof...(Bodies);
+
+  camp::tuple<Bodies...> bodies;
+
+  template <camp::idx_t K,
+            camp::idx_t Offset,
+            camp::idx_t... Seq,
+            typename Index,
+            typename Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void callOne(camp::idx_seq<Seq...>,
+                                            Index&& i,
+                                            Args& args) const
+  {
+    camp::get<K>(bodies).body(i, camp::get<Offset + Seq>(args)...);
+  }
+
+  template <camp::idx_t K, camp::idx_t Offset, typename Index, typename Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void call(Index&& i, Args& args) const
+  {
+    using traits = fused_body_traits<camp::at_v<camp::list<Bodies...>, K>>;
+    callOne<K, Offset>(camp::make_idx_seq_t<traits::num_args>{}, i, args);
+  }
+
+  //
+  // Each body in turn for one index
+  //
+  template <camp::idx_t K, camp::idx_t Offset, typename Index, typename Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void callAll(std::true_type,
+                                            Index&&,
+                                            Args&) const
+  {
+  }
+
+  template <camp::idx_t K, camp::idx_t Offset, typename Index, typename Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void callAll(std::false_type,
+                                            Index&& i,
+                                            Args& args) const
+  {
+    using traits = fused_body_traits<camp::at_v<camp::list<Bodies...>, K>>;
+    call<K, Offset>(i, args);
+    callAll<K + 1, Offset + traits::num_args>(
+        std::integral_constant<bool, K + 1 == num_bodies>{}, i, args);
+  }
+
+  //
+  // Each body in turn for the indices begin[first, last)
+  //
+  template <camp::idx_t K,
+            camp::idx_t Offset,
+            typename Iterator,
+            typename Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void callAllStrip(std::true_type,
+                                                 Iterator const&,
+                                                 Index_type,
+                                                 Index_type,
+                                                 Args&) const
+  {
+  }
+
+  template <camp::idx_t K,
+            camp::idx_t Offset,
+            typename Iterator,
+            typename Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void callAllStrip(std::false_type,
+                                                 Iterator const& begin,
+                                                 Index_type first,
+                                                 Index_type last,
+                                                 Args& args) const
+  {
+    using traits = fused_body_traits<camp::at_v<camp::list<Bodies...>, K>>;
+    for (Index_type i = first; i < last; ++i) {
+      call<K, Offset>(begin[i], args);
+    }
+    callAllStrip<K + 1, Offset + traits::num_args>(
+        std::integral_constant<bool, K + 1 == num_bodies>{},
+        begin,
+        first,
+        last,
+        args);
+  }
+};
+
+//! Loop body running every fused body at each index of the segment
+template <typename... Bodies>
+struct FusedLoopBody {
+  FusedBodies<Bodies...> fused;
+
+  template <typename Index, typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index i, Args&... args) const
+  {
+    auto arg_tup = camp::forward_as_tuple(args...);
+    fused.template callAll<0, 0>(std::false_type{}, i, arg_tup);
+  }
+};
+
+//! Loop body over strip numbers, running every fused body over each strip
+template <typename Iterator, typename... Bodies>
+struct FusedStripLoopBody {
+  FusedBodies<Bodies...> fused;
+  Iterator begin;
+  Index_type len;
+  Index_type strip;
+
+  template <typename... Args>
+  RAJA_HOST_DEVICE RAJA_INLINE void operator()(Index_type s,
+                                               Args&... args) const
+  {
+    const Index_type first = s * strip;
+    const Index_type last = first + strip < len ? first + strip : len;
+    auto arg_tup = camp::forward_as_tuple(args...);
+    fused.template callAllStrip<0, 0>(
+        std::false_type{}, begin, first, last, arg_tup);
+  }
+};
+
+//
+// Passes the parameters of all bodies, in order, to forall
+//
+template <typename ExecutionPolicy,
+          camp::idx_t K,
+          typename Res,
+          typename Container,
+          typename LoopBody,
+          typename Bodies,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Res> forall_fused_params(
+    std::true_type,
+    Res r,
+    Container&& c,
+    LoopBody&& loop_body,
+    Bodies&,
+    Params&... params)
+{
+  return ::RAJA::forall<ExecutionPolicy>(r,
+                                         std::forward<Container>(c),
+                                         params...,
+                                         std::forward<LoopBody>(loop_body));
+}
+
+template <typename ExecutionPolicy,
+          camp::idx_t K,
+          typename Res,
+          typename Container,
+          typename LoopBody,
+          typename Bodies,
+          camp::idx_t... Seq,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Res> forall_fused_params_append(
+    camp::idx_seq<Seq...>,
+    Res r,
+    Container&& c,
+    LoopBody&& loop_body,
+    Bodies& bodies,
+    Params&... params)
+{
+  return forall_fused_params<ExecutionPolicy, K + 1>(
+      std::integral_constant<bool, K + 1 == camp::tuple_size<Bodies>::value>{},
+      r,
+      std::forward<Container>(c),
+      std::forward<LoopBody>(loop_body),
+      bodies,
+      params...,
+      camp::get<Seq>(camp::get<K>(bodies).params)...);
+}
+
+template <typename ExecutionPolicy,
+          camp::idx_t K,
+          typename Res,
+          typename Container,
+          typename LoopBody,
+          typename Bodies,
+          typename... Params>
+RAJA_INLINE resources::EventProxy<Res> forall_fused_params(
+    std::false_type,
+    Res r,
+    Container&& c,
+    LoopBody&& loop_body,
+    Bodies& bodies,
+    Params&... params)
+{
+  using body_params = typename fused_body_traits<
+      camp::decay<decltype(camp::get<K>(bodies))>>::params;
+  return forall_fused_params_append<ExecutionPolicy, K>(
+      camp::make_idx_seq_t<camp::tuple_size<body_params>::value>{},
+      r,
+      std::forward<Container>(c),
+      std::forward<LoopBody>(loop_body),
+      bodies,
+      params...);
+}
+
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<Res> forall_fused_impl(
+    Res r,
+    Container&& c,
+    StripMine strip,
+    Bodies&&... bodies)
+{
+  static_assert(sizeof...(Bodies) > 0, "forall_fused needs a loop body");
+  static_assert(type_traits::is_random_access_range<camp::decay<Container>>::value,
+                "forall_fused needs a random access container");
+
+  auto fused_bodies = camp::make_tuple(
+      make_fused_body(std::forward<Bodies>(bodies))...);
+
+  auto begin = std::begin(c);
+  const Index_type len =
+      static_cast<Index_type>(std::distance(begin, std::end(c)));
+  const Index_type num_strips = (len + strip.size - 1) / strip.size;
+
+  using Iterator = decltype(begin);
+  FusedStripLoopBody<Iterator, decltype(make_fused_body(std::forward<Bodies>(bodies)))...>
+      loop_body{{fused_bodies}, begin, len, strip.size};
+
+  return forall_fused_params<ExecutionPolicy, 0>(
+      std::false_type{},
+      r,
+      TypedRangeSegment<Index_type>(0, num_strips),
+      loop_body,
+      fused_bodies);
+}
+
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename First,
+          typename... Bodies>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<std::is_same<camp::decay<First>, StripMine>>>
+forall_fused_impl(Res r, Container&& c, First&& first, Bodies&&... bodies)
+{
+  auto fused_bodies =
+      camp::make_tuple(make_fused_body(std::forward<First>(first)),
+                       make_fused_body(std::forward<Bodies>(bodies))...);
+
+  FusedLoopBody<decltype(make_fused_body(std::forward<First>(first))),
+                decltype(make_fused_body(std::forward<Bodies>(bodies)))...>
+      loop_body{{fused_bodies}};
+
+  return forall_fused_params<ExecutionPolicy, 0>(std::false_type{},
+                                                 r,
+                                                 std::forward<Container>(c),
+                                                 loop_body,
+                                                 fused_bodies);
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Loop body for forall_fused with its own expt parameters, given in
+ *        the same order as to forall:
+ *
+ *          fused_body(RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+ *                     [=](int i, double& s) { s += a[i]; })
+ *
+ ******************************************************************************
+ */
+template <typename... Args>
+RAJA_INLINE auto fused_body(Args&&... args)
+    -> decltype(detail::fused_body_from_args(
+        camp::make_idx_seq_t<sizeof...(Args) - 1>{},
+        camp::make_tuple(std::forward<Args>(args)...)))
+{
+  static_assert(sizeof...(Args) > 0, "fused_body needs a loop body");
+  return detail::fused_body_from_args(
+      camp::make_idx_seq_t<sizeof...(Args) - 1>{},
+      camp::make_tuple(std::forward<Args>(args)...));
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Run several loop bodies over the same segment in one loop.
+ *
+ *          forall_fused<exec_policy>(segment, body1, body2, ...);
+ *          forall_fused<exec_policy>(segment, strip_mine(n), body1, ...);
+ *
+ *        Without a StripMine every body runs at an index before the next
+ *        index starts. With a StripMine the segment is cut into strips of
+ *        n iterations, exec_policy runs over the strips and each strip is
+ *        run through body1, then body2, and so on. In both cases body k
+ *        may use results of the earlier bodies only at the same index
+ *        (or, when strip-mined, within the same strip).
+ *
+ *        Bodies wrapped with fused_body carry their own reducers; each is
+ *        called with the index followed by the arguments of its own
+ *        parameters.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy,
+          typename Res,
+          typename Container,
+          typename... Bodies>
+RAJA_INLINE concepts::enable_if_t<resources::EventProxy<Res>,
+                                  type_traits::is_resource<Res>>
+forall_fused(Res r, Container&& c, Bodies&&... bodies)
+{
+  return detail::forall_fused_impl<ExecutionPolicy>(
+      r, std::forward<Container>(c), std::forward<Bodies>(bodies)...);
+}
+
+template <typename ExecutionPolicy,
+          typename Container,
+          typename... Bodies,
+          typename Res =
+              typename resources::get_resource<ExecutionPolicy>::type>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<Res>,
+    concepts::negate<type_traits::is_resource<camp::decay<Container>>>>
+forall_fused(Container&& c, Bodies&&... bodies)
+{
+  Res r = Res::get_default();
+  return detail::forall_fused_impl<ExecutionPolicy>(
+      r, std::forward<Container>(c), std::forward<Bodies>(bodies)...);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
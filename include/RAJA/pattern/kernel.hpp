@@ -20,6 +20,8 @@
 
 #include "RAJA/config.hpp"
 
+#include <iterator>
+
 #include "RAJA/internal/get_platform.hpp"
 #include "RAJA/util/plugins.hpp"
 
@@ -82,6 +84,18 @@ RAJA_INLINE constexpr auto make_wrapped_tuple_impl(Tuple &&t,
               IndexType>{camp::get<I>(std::forward<Tuple>(t)).begin(),
                          camp::get<I>(std::forward<Tuple>(t)).end()}...);
 }
+
+/// Number of iterations in the product of the segments, reported to plugins
+template <class Tuple, camp::idx_t... I>
+RAJA_INLINE size_t segment_tuple_iteration_count(Tuple const &t,
+                                                 camp::idx_seq<I...>)
+{
+  size_t count = 1;
+  camp::sink((count *= static_cast<size_t>(
+                  std::distance(std::begin(camp::get<I>(t)),
+                                std::end(camp::get<I>(t)))))...);
+  return count;
+}
 }  // namespace internal
 
 template <class Tuple>
@@ -106,7 +120,14 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                                                   Resource resource,
                                                                   Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  const bool use_plugins = util::plugins_active();
+  util::PluginContext context{use_plugins ?
+      util::make_context<PolicyType, camp::list<camp::decay<Bodies>...>>(
+          nullptr,
+          internal::segment_tuple_iteration_count(
+              segments,
+              camp::make_idx_seq_t<camp::tuple_size<camp::decay<SegmentTuple>>::value>{}))
+      : util::PluginContext{Platform::undefined}};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -125,7 +146,7 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                          camp::decay<Bodies>...>;
 
 
-  util::callPreCapturePlugins(context);
+  if (use_plugins) { util::callPreCapturePlugins(context); }
 
   // Create the LoopData object, which contains our policy object,
   // our segments, loop bodies, and the tuple of loop indices
@@ -137,17 +158,17 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                             resource,
                             std::forward<Bodies>(bodies)...);
 
-  util::callPostCapturePlugins(context);
+  if (use_plugins) { util::callPostCapturePlugins(context); }
 
   using loop_types_t = internal::makeInitialLoopTypes<loop_data_t>;
 
-  util::callPreLaunchPlugins(context);
+  if (use_plugins) { util::callPreLaunchPlugins(context); }
 
   // Execute!
   RAJA_FORCEINLINE_RECURSIVE
   internal::execute_statement_list<PolicyType, loop_types_t>(loop_data);
 
-  util::callPostLaunchPlugins(context);
+  if (use_plugins) { util::callPostLaunchPlugins(context); }
 
   return resources::EventProxy<Resource>(resource);
 }
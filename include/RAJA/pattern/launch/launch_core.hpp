@@ -151,6 +151,20 @@ private:
   Threads apply(Threads const &a) { return (threads = a); }
 };
 
+namespace detail
+{
+/// Number of threads over all teams in a launch, reported to plugins
+RAJA_INLINE size_t launch_iteration_count(LaunchParams const &params)
+{
+  size_t count = 1;
+  for (int i = 0; i < 3; ++i) {
+    count *= static_cast<size_t>(params.teams.value[i]) *
+             static_cast<size_t>(params.threads.value[i]);
+  }
+  return count;
+}
+}  // namespace detail
+
 class LaunchContext
 {
 public:
@@ -227,15 +241,19 @@ void launch(LaunchParams const &params, const char *kernel_name, BODY const &bod
 {
   //Take the first policy as we assume the second policy is not user defined.
   //We rely on the user to pair launch and loop policies correctly.
-  util::PluginContext context{util::make_context<typename LAUNCH_POLICY::host_policy_t>()};
-  util::callPreCapturePlugins(context);
+  const bool use_plugins = util::plugins_active();
+  util::PluginContext context{use_plugins ?
+      util::make_context<typename LAUNCH_POLICY::host_policy_t, BODY>(
+          kernel_name, detail::launch_iteration_count(params))
+      : util::PluginContext{Platform::undefined}};
+  if (use_plugins) { util::callPreCapturePlugins(context); }
 
   using RAJA::util::trigger_updates_before;
   auto p_body = trigger_updates_before(body);
 
-  util::callPostCapturePlugins(context);
+  if (use_plugins) { util::callPostCapturePlugins(context); }
 
-  util::callPreLaunchPlugins(context);
+  if (use_plugins) { util::callPreLaunchPlugins(context); }
 
   using launch_t = LaunchExecute<typename LAUNCH_POLICY::host_policy_t>;
 
@@ -243,7 +261,7 @@ void launch(LaunchParams const &params, const char *kernel_name, BODY const &bod
 
   launch_t::exec(Res::get_default(), params, kernel_name, p_body);
 
-  util::callPostLaunchPlugins(context);
+  if (use_plugins) { util::callPostLaunchPlugins(context); }
 }
 
 
@@ -318,35 +336,43 @@ launch(RAJA::resources::Resource res, LaunchParams const &params, const char *ke
   //
   //Configure plugins
   //
+  const bool use_plugins = util::plugins_active();
 #if defined(RAJA_GPU_ACTIVE)
-  util::PluginContext context{place == ExecPlace::HOST ?
-      util::make_context<typename POLICY_LIST::host_policy_t>()
-      : util::make_context<typename POLICY_LIST::device_policy_t>()};
+  util::PluginContext context{!use_plugins ?
+      util::PluginContext{Platform::undefined}
+      : place == ExecPlace::HOST ?
+      util::make_context<typename POLICY_LIST::host_policy_t, BODY>(
+          kernel_name, detail::launch_iteration_count(params))
+      : util::make_context<typename POLICY_LIST::device_policy_t, BODY>(
+          kernel_name, detail::launch_iteration_count(params))};
 #else
-  util::PluginContext context{util::make_context<typename POLICY_LIST::host_policy_t>()};
+  util::PluginContext context{use_plugins ?
+      util::make_context<typename POLICY_LIST::host_policy_t, BODY>(
+          kernel_name, detail::launch_iteration_count(params))
+      : util::PluginContext{Platform::undefined}};
 #endif
 
-  util::callPreCapturePlugins(context);
+  if (use_plugins) { util::callPreCapturePlugins(context); }
 
   using RAJA::util::trigger_updates_before;
   auto p_body = trigger_updates_before(body);
 
-  util::callPostCapturePlugins(context);
+  if (use_plugins) { util::callPostCapturePlugins(context); }
 
-  util::callPreLaunchPlugins(context);
+  if (use_plugins) { util::callPreLaunchPlugins(context); }
 
   switch (place) {
     case ExecPlace::HOST: {
       using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
       resources::EventProxy<resources::Resource> e_proxy = launch_t::exec(res, params, kernel_name, p_body);
-      util::callPostLaunchPlugins(context);
+      if (use_plugins) { util::callPostLaunchPlugins(context); }
       return e_proxy;
     }
 #if defined(RAJA_GPU_ACTIVE)
     case ExecPlace::DEVICE: {
       using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
       resources::EventProxy<resources::Resource> e_proxy = launch_t::exec(res, params, kernel_name, p_body);
-      util::callPostLaunchPlugins(context);
+      if (use_plugins) { util::callPostLaunchPlugins(context); }
       return e_proxy;
     }
 #endif
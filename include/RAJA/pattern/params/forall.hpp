@@ -8,6 +8,7 @@
 #include "RAJA/policy/cuda/params/kernel_name.hpp"
 #include "RAJA/policy/hip/params/reduce.hpp"
 #include "RAJA/policy/sycl/params/reduce.hpp"
+#include "RAJA/policy/thread_pool/params/reduce.hpp"
 
 #include "RAJA/util/CombiningAdapter.hpp"
 
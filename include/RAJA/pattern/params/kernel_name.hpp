@@ -1,6 +1,8 @@
 #ifndef RAJA_KERNEL_NAME_HPP
 #define RAJA_KERNEL_NAME_HPP
 
+#include <type_traits>
+
 #include "RAJA/pattern/params/params_base.hpp"
 
 namespace RAJA
@@ -16,6 +18,32 @@ namespace detail
     const char* name;
   };
 
+  //
+  // Find the name in a pack of forall arguments, nullptr if there is none
+  //
+  RAJA_INLINE const char* get_kernel_name() { return nullptr; }
+
+  template <typename First, typename... Rest>
+  RAJA_INLINE const char* get_kernel_name(First const& first, Rest const&... rest);
+
+  template <typename First, typename... Rest>
+  RAJA_INLINE const char* get_kernel_name_impl(std::true_type, First const& first, Rest const&...)
+  {
+    return first.name;
+  }
+
+  template <typename First, typename... Rest>
+  RAJA_INLINE const char* get_kernel_name_impl(std::false_type, First const&, Rest const&... rest)
+  {
+    return get_kernel_name(rest...);
+  }
+
+  template <typename First, typename... Rest>
+  RAJA_INLINE const char* get_kernel_name(First const& first, Rest const&... rest)
+  {
+    return get_kernel_name_impl(std::is_same<First, KernelName>{}, first, rest...);
+  }
+
 } // namespace detail
 
 inline auto KernelName(const char * n)
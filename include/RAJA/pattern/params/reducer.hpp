@@ -1,8 +1,19 @@
 #ifndef NEW_REDUCE_HPP
 #define NEW_REDUCE_HPP
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
 #include "RAJA/pattern/params/params_base.hpp"
+#include "RAJA/util/ReproSum.hpp"
 #include "RAJA/util/SoAPtr.hpp"
+#include "RAJA/util/types.hpp"
 
 #if defined(RAJA_CUDA_ACTIVE)
 #include "RAJA/policy/cuda/MemUtils_CUDA.hpp"
@@ -35,14 +46,163 @@ struct ValLoc {
   bool constexpr operator > (const ValLoc& rhs) const { return val >= rhs.val; }
   bool constexpr operator >=(const ValLoc& rhs) const { return val > rhs.val; }
 
-  value_type getVal() {return val;}
-  RAJA::Index_type getLoc() {return loc;}
+  value_type getVal() const {return val;}
+  RAJA::Index_type getLoc() const {return loc;}
 
 private:
   value_type val;
   index_type loc = -1;
 };
 
+//
+// Count, mean, variance, min and max of the values added to it, in one pass.
+// The mean and sum of squared deviations are updated with Welford's method
+// and merged with the pairwise formula of Chan et al., so partial results of
+// any number of threads combine without the cancellation of a sum of
+// squares. Integral values are accumulated in double.
+//
+template<typename T>
+struct Stats {
+  using index_type = RAJA::Index_type;
+  using value_type = T;
+  using stat_type =
+      typename std::conditional<std::is_floating_point<T>::value, T, double>::type;
+
+  RAJA_HOST_DEVICE constexpr Stats() {}
+
+  RAJA_HOST_DEVICE void add(value_type v) {
+    const stat_type x = static_cast<stat_type>(v);
+    ++count;
+    const stat_type delta = x - mean;
+    mean += delta / static_cast<stat_type>(count);
+    m2 += delta * (x - mean);
+    if (v < minval) { minval = v; }
+    if (v > maxval) { maxval = v; }
+  }
+
+  RAJA_HOST_DEVICE Stats& operator+=(value_type v) { add(v); return *this; }
+
+  RAJA_HOST_DEVICE void combine(const Stats& rhs) {
+    if (rhs.count == 0) { return; }
+    if (count == 0) { *this = rhs; return; }
+    const stat_type n_lhs = static_cast<stat_type>(count);
+    const stat_type n_rhs = static_cast<stat_type>(rhs.count);
+    const stat_type n = n_lhs + n_rhs;
+    const stat_type delta = rhs.mean - mean;
+    mean += delta * (n_rhs / n);
+    m2 += rhs.m2 + delta * delta * (n_lhs * n_rhs / n);
+    count += rhs.count;
+    if (rhs.minval < minval) { minval = rhs.minval; }
+    if (rhs.maxval > maxval) { maxval = rhs.maxval; }
+  }
+
+  index_type getCount() const {return count;}
+  stat_type getMean() const {return mean;}
+  // population variance, sum of squared deviations over count
+  stat_type getVariance() const {return count > 0 ? m2 / static_cast<stat_type>(count) : stat_type(0);}
+  // sample variance, sum of squared deviations over count - 1
+  stat_type getSampleVariance() const {return count > 1 ? m2 / static_cast<stat_type>(count - 1) : stat_type(0);}
+  value_type getMin() const {return minval;}
+  value_type getMax() const {return maxval;}
+
+private:
+  index_type count = 0;
+  stat_type mean = 0;
+  stat_type m2 = 0;
+  value_type minval = RAJA::operators::limits<T>::max();
+  value_type maxval = RAJA::operators::limits<T>::min();
+};
+
+//
+// The K best values added to it and their indices, ordered by Compare, e.g.
+// the K largest with operators::greater or the K smallest with
+// operators::less. The values are kept in a binary heap with the worst one
+// at the root, so adding a value costs O(log K) and a value that is not
+// better than the root is rejected after one comparison. Ties go to the
+// smaller index, so the result does not depend on how the values were
+// split among threads.
+//
+template<typename T, int K, typename Compare = RAJA::operators::greater<T>>
+struct TopK {
+  static_assert(K > 0, "TopK needs K > 0");
+
+  using index_type = RAJA::Index_type;
+  using value_type = T;
+
+  RAJA_HOST_DEVICE TopK() {}
+
+  RAJA_HOST_DEVICE void add(value_type v, index_type l) {
+    if (count < K) {
+      int i = count++;
+      while (i > 0 && better(vals[(i - 1) / 2], locs[(i - 1) / 2], v, l)) {
+        vals[i] = vals[(i - 1) / 2];
+        locs[i] = locs[(i - 1) / 2];
+        i = (i - 1) / 2;
+      }
+      vals[i] = v;
+      locs[i] = l;
+    } else if (better(v, l, vals[0], locs[0])) {
+      sift_down(vals, locs, count, v, l);
+    }
+  }
+
+  RAJA_HOST_DEVICE void combine(const TopK& rhs) {
+    for (int i = 0; i < rhs.count; ++i) {
+      add(rhs.vals[i], rhs.locs[i]);
+    }
+  }
+
+  int size() const {return count;}
+
+  // the retained values best first, returns how many were written to out
+  int getSorted(ValLoc<value_type>* out) const {
+    value_type v[K];
+    index_type l[K];
+    for (int i = 0; i < count; ++i) {
+      v[i] = vals[i];
+      l[i] = locs[i];
+    }
+    for (int n = count; n > 0; --n) {
+      out[n - 1] = ValLoc<value_type>(v[0], l[0]);
+      sift_down(v, l, n - 1, v[n - 1], l[n - 1]);
+    }
+    return count;
+  }
+
+private:
+  RAJA_HOST_DEVICE static bool better(value_type va, index_type la,
+                                      value_type vb, index_type lb) {
+    return Compare{}(va, vb) || (!Compare{}(vb, va) && la < lb);
+  }
+
+  // put v at the root of the heap of the first n values, in place of its
+  // worst value
+  RAJA_HOST_DEVICE static void sift_down(value_type* hv, index_type* hl, int n,
+                                         value_type v, index_type l) {
+    int i = 0;
+    for (int c = 1; c < n && c < K; c = 2 * i + 1) {
+      if (c + 1 < n && c + 1 < K &&
+          better(hv[c], hl[c], hv[c + 1], hl[c + 1])) {
+        ++c;
+      }
+      if (!better(v, l, hv[c], hl[c])) {
+        break;
+      }
+      hv[i] = hv[c];
+      hl[i] = hl[c];
+      i = c;
+    }
+    if (n > 0) {
+      hv[i] = v;
+      hl[i] = l;
+    }
+  }
+
+  value_type vals[K];
+  index_type locs[K];
+  int count = 0;
+};
+
 } //  namespace expt
 
 namespace operators
@@ -110,6 +270,30 @@ namespace detail
     static constexpr size_t num_lambda_args = camp::tuple_size<ARG_TUP_T>::value ;
   };
 
+  //
+  //
+  // Reproducible sum Reducer, accumulates into a ReproSum that is passed to
+  // the lambda so the result does not depend on the thread count. Host only.
+  //
+  //
+  template <typename T>
+  struct Reducer<RAJA::operators::repro_plus<T, T, T>, T> : public ForallParamBase {
+    using op = RAJA::operators::repro_plus<T, T, T>;
+    using value_type = T;
+
+    Reducer() {}
+    Reducer(value_type *target_in) : target(target_in) {}
+
+    value_type *target = nullptr;
+    ReproSum<T> val;
+
+    using ARG_TUP_T = camp::tuple<ReproSum<T>*>;
+    ARG_TUP_T get_lambda_arg_tup() { return camp::make_tuple(&val); }
+
+    using ARG_LIST_T = typename ARG_TUP_T::TList;
+    static constexpr size_t num_lambda_args = camp::tuple_size<ARG_TUP_T>::value ;
+  };
+
 } // namespace detail
 
 template <template <typename, typename, typename> class Op, typename T>
@@ -145,6 +329,207 @@ auto constexpr ReduceLoc(T *target)
 {
   return detail::ReducerLoc<Op<T, T, T>, T>(target);
 }
+
+
+
+namespace detail
+{
+
+  //
+  //
+  // Operator merging partial Stats, the empty Stats is the identity.
+  //
+  //
+  template <typename T>
+  struct stats_combine {
+    RAJA_HOST_DEVICE Stats<T> operator()(Stats<T> lhs, const Stats<T>& rhs) const
+    {
+      lhs.combine(rhs);
+      return lhs;
+    }
+
+    RAJA_HOST_DEVICE static constexpr Stats<T> identity() { return Stats<T>(); }
+  };
+
+} // namespace detail
+
+template <typename T>
+auto constexpr ReduceStats(Stats<T> *target)
+{
+  return detail::Reducer<detail::stats_combine<T>, Stats<T>>(target);
+}
+
+
+
+namespace detail
+{
+
+  //
+  //
+  // Operator merging partial TopK, the empty TopK is the identity.
+  //
+  //
+  template <typename T, int K, typename Compare>
+  struct topk_combine {
+    RAJA_HOST_DEVICE TopK<T, K, Compare> operator()(TopK<T, K, Compare> lhs,
+                                                    const TopK<T, K, Compare>& rhs) const
+    {
+      lhs.combine(rhs);
+      return lhs;
+    }
+
+    RAJA_HOST_DEVICE static TopK<T, K, Compare> identity() { return TopK<T, K, Compare>(); }
+  };
+
+} // namespace detail
+
+template <int K, typename T, typename Compare>
+auto ReduceTopK(TopK<T, K, Compare> *target)
+{
+  return detail::Reducer<detail::topk_combine<T, K, Compare>, TopK<T, K, Compare>>(target);
+}
+
+
+
+namespace detail
+{
+
+  //
+  //
+  // Private arrays of an ArrayReducer on a parallel back-end, one slot per
+  // thread, each starting on its own cache line. Every private copy of the
+  // reducer claims a slot, so the slots can be merged in blocks of elements
+  // after the loop instead of one copy at a time.
+  //
+  //
+  template <typename T>
+  struct ArrayReducerSlots {
+    ArrayReducerSlots(size_t size, size_t max_slots_in)
+      : slot_size(size), stride(padded_bytes(size)), max_slots(max_slots_in),
+        storage(new char[stride * max_slots_in + cache_line_size])
+    {
+      // operator new[] only guarantees fundamental alignment
+      const size_t offset =
+          reinterpret_cast<std::uintptr_t>(storage.get()) % cache_line_size;
+      base = storage.get() + (offset ? cache_line_size - offset : 0);
+      for (size_t s = 0; s < max_slots; ++s) {
+        for (size_t i = 0; i < slot_size; ++i) {
+          new (slot(s) + i) T();
+        }
+      }
+    }
+
+    ArrayReducerSlots(ArrayReducerSlots const&) = delete;
+    ArrayReducerSlots& operator=(ArrayReducerSlots const&) = delete;
+
+    ~ArrayReducerSlots()
+    {
+      for (size_t s = 0; s < max_slots; ++s) {
+        for (size_t i = 0; i < slot_size; ++i) {
+          slot(s)[i].~T();
+        }
+      }
+    }
+
+    // Slot filled with identity, or nullptr when all slots are taken.
+    T* claim(size_t size, T identity) {
+      const size_t s = next.fetch_add(1, std::memory_order_relaxed);
+      if (s >= max_slots) {
+        return nullptr;
+      }
+      std::fill_n(slot(s), size, identity);
+      return slot(s);
+    }
+
+    size_t num_claimed() const {
+      const size_t n = next.load(std::memory_order_relaxed);
+      return n < max_slots ? n : max_slots;
+    }
+
+    T* slot(size_t s) { return reinterpret_cast<T*>(base + s * stride); }
+
+  private:
+    static size_t padded_bytes(size_t size) {
+      return (size * sizeof(T) + cache_line_size - 1) / cache_line_size *
+             cache_line_size;
+    }
+
+    size_t slot_size;
+    size_t stride;
+    size_t max_slots;
+    std::unique_ptr<char[]> storage;
+    char* base;
+    std::atomic<size_t> next{0};
+  };
+
+  //
+  //
+  // Array Reducer, reduces each of the size elements of target with Op.
+  // The lambda gets a pointer to a private array that starts at the
+  // identity, e.g. the bins of a histogram. Copies made after init get their
+  // own array, from the slots when the back-end sets them up. Host only.
+  //
+  //
+  template <typename Op, typename T>
+  struct ArrayReducer : public ForallParamBase {
+    using op = Op;
+    using value_type = T;
+
+    ArrayReducer() {}
+    ArrayReducer(value_type *target_in, size_t size_in) : target(target_in), size(size_in) {}
+
+    ArrayReducer(const ArrayReducer& other)
+      : target(other.target), size(other.size), slots(other.slots)
+    {
+      if (other.val == nullptr) {
+        return;
+      }
+      if (slots) {
+        val = slots->claim(size, op::identity());
+      }
+      if (val == nullptr) {
+        bins.assign(other.val, other.val + size);
+        val = bins.data();
+      }
+    }
+
+    ArrayReducer& operator=(const ArrayReducer& other)
+    {
+      if (this != &other) {
+        target = other.target;
+        size = other.size;
+        slots = other.slots;
+        if (other.val == nullptr) {
+          bins.clear();
+          val = nullptr;
+        } else {
+          bins.assign(other.val, other.val + size);
+          val = bins.data();
+        }
+      }
+      return *this;
+    }
+
+    value_type *target = nullptr;
+    size_t size = 0;
+    value_type *val = nullptr;
+    std::vector<value_type> bins;
+    std::shared_ptr<ArrayReducerSlots<value_type>> slots;
+
+    using ARG_TUP_T = camp::tuple<value_type**>;
+    ARG_TUP_T get_lambda_arg_tup() { return camp::make_tuple(&val); }
+
+    using ARG_LIST_T = typename ARG_TUP_T::TList;
+    static constexpr size_t num_lambda_args = camp::tuple_size<ARG_TUP_T>::value ;
+  };
+
+} // namespace detail
+
+template <template <typename, typename, typename> class Op, typename T>
+auto ReduceArray(T *target, size_t size)
+{
+  return detail::ArrayReducer<Op<T, T, T>, T>(target, size);
+}
 } // namespace expt
 
 
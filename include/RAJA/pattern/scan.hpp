@@ -31,6 +31,41 @@
 namespace RAJA
 {
 
+namespace detail
+{
+
+/*!
+ * \brief Segment heads of a scan by key, the indices i > 0 whose key
+ * differs from the key at i - 1
+ */
+template <typename KeyIter>
+struct KeyChangeHeads {
+  KeyIter keys;
+
+  template <typename DiffType>
+  RAJA_INLINE bool operator()(DiffType i) const
+  {
+    return !(keys[i] == keys[i - 1]);
+  }
+};
+
+/*!
+ * \brief Segment heads of a segmented scan, the indices i > 0 whose flag is
+ * set
+ */
+template <typename FlagIter>
+struct FlagHeads {
+  FlagIter flags;
+
+  template <typename DiffType>
+  RAJA_INLINE bool operator()(DiffType i) const
+  {
+    return static_cast<bool>(flags[i]);
+  }
+};
+
+}  // namespace detail
+
 inline namespace policy_by_value_interface
 {
 
@@ -320,6 +355,368 @@ exclusive_scan(ExecPolicy&& p,
       value);
 }
 
+/*!
+******************************************************************************
+*
+* \brief  inclusive scan by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of keys, a scan restarts where
+*consecutive keys differ
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[in] binop binary function to apply for scan
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_by_key(ExecPolicy&& p,
+                      Res r,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  using Heads = RAJA::detail::KeyChangeHeads<RAJA::detail::ContainerIter<KeyContainer>>;
+  return impl::scan::inclusive_segmented(r, std::forward<ExecPolicy>(p),
+                                         begin(in), end(in), begin(out),
+                                         Heads{begin(keys)}, binop);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_scan_by_key(ExecPolicy&& p,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive scan by key execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] keys Random-Access Container of keys, a scan restarts where
+*consecutive keys differ
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[in] binop binary function to apply for scan
+* \param[in] value value each segment starts from, the identity for binop
+*by default
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<KeyContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_by_key(ExecPolicy&& p,
+                      Res r,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{},
+                      T value = Function::identity())
+{
+  using std::begin;
+  using std::end;
+  using U = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<KeyContainer>::value,
+                "KeyContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  using Heads = RAJA::detail::KeyChangeHeads<RAJA::detail::ContainerIter<KeyContainer>>;
+  return impl::scan::exclusive_segmented(r, std::forward<ExecPolicy>(p),
+                                         begin(in), end(in), begin(out),
+                                         Heads{begin(keys)}, binop, value);
+}
+///
+template <typename ExecPolicy,
+          typename KeyContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<KeyContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, KeyContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_scan_by_key(ExecPolicy&& p,
+                      KeyContainer&& keys,
+                      InContainer&& in,
+                      OutContainer&& out,
+                      Function binop = Function{},
+                      T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_by_key(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<KeyContainer>(keys),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop,
+      value);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  inclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] flags Random-Access Container of flags, a scan restarts at every
+*set flag
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[in] binop binary function to apply for scan
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  using std::begin;
+  using std::end;
+  using T = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, R>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<FlagContainer>::value,
+                "FlagContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  using Heads = RAJA::detail::FlagHeads<RAJA::detail::ContainerIter<FlagContainer>>;
+  return impl::scan::inclusive_segmented(r, std::forward<ExecPolicy>(p),
+                                         begin(in), end(in), begin(out),
+                                         Heads{begin(flags)}, binop);
+}
+///
+template <typename ExecPolicy,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename Function = operators::plus<RAJA::detail::ContainerVal<InContainer>>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<FlagContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, FlagContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+inclusive_segmented_scan(ExecPolicy&& p,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{})
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<FlagContainer>(flags),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop);
+}
+
+/*!
+******************************************************************************
+*
+* \brief  exclusive segmented scan execution pattern
+*
+* \param[in] p Execution policy
+* \param[in] flags Random-Access Container of flags, a scan restarts at every
+*set flag
+* \param[in] in Random-Access Container
+* \param[out] out Random-Access Container for the output data
+* \param[in] binop binary function to apply for scan
+* \param[in] value value each segment starts from, the identity for binop
+*by default
+*
+* \note{The range of [begin, end) must be separate from [out, out + (end -
+*begin))}
+******************************************************************************
+*/
+template <typename ExecPolicy,
+          typename Res,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>,
+                      std::is_constructible<camp::resources::Resource, Res>,
+                      type_traits::is_range<FlagContainer>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         Res r,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  using std::begin;
+  using std::end;
+  using U = RAJA::detail::ContainerVal<InContainer>;
+  using R = RAJA::detail::ContainerVal<OutContainer>;
+  static_assert(type_traits::is_binary_function<Function, R, T, U>::value,
+                "Function must model BinaryFunction");
+  static_assert(type_traits::is_random_access_range<FlagContainer>::value,
+                "FlagContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<InContainer>::value,
+                "InContainer must model RandomAccessRange");
+  static_assert(type_traits::is_random_access_range<OutContainer>::value,
+                "OutContainer must model RandomAccessRange");
+  if (begin(in) == end(in)) {
+    return resources::EventProxy<Res>(r);
+  }
+  using Heads = RAJA::detail::FlagHeads<RAJA::detail::ContainerIter<FlagContainer>>;
+  return impl::scan::exclusive_segmented(r, std::forward<ExecPolicy>(p),
+                                         begin(in), end(in), begin(out),
+                                         Heads{begin(flags)}, binop, value);
+}
+///
+template <typename ExecPolicy,
+          typename FlagContainer,
+          typename InContainer,
+          typename OutContainer,
+          typename T = RAJA::detail::ContainerVal<InContainer>,
+          typename Function = operators::plus<T>,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_range<FlagContainer>,
+                      concepts::negate<std::is_constructible<camp::resources::Resource, FlagContainer>>,
+                      type_traits::is_range<InContainer>,
+                      type_traits::is_range<OutContainer>>
+exclusive_segmented_scan(ExecPolicy&& p,
+                         FlagContainer&& flags,
+                         InContainer&& in,
+                         OutContainer&& out,
+                         Function binop = Function{},
+                         T value = Function::identity())
+{
+  auto r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      std::forward<ExecPolicy>(p),
+      r,
+      std::forward<FlagContainer>(flags),
+      std::forward<InContainer>(in),
+      std::forward<OutContainer>(out),
+      binop,
+      value);
+}
+
 }  // end inline namespace policy_by_value_interface
 
 
@@ -439,6 +836,122 @@ inclusive_scan_inplace(Res r, Args&&... args)
       ExecPolicy(), r, std::forward<Args>(args)...);
 }
 
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_scan_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_scan_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_scan_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_scan_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_scan_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_scan_by_key
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_scan_by_key(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_scan_by_key<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_scan_by_key(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_scan_by_key(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * inclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+inclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+inclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::inclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
+/*!
+ * \brief Conversion from template-based policy to value-based policy for
+ * exclusive_segmented_scan
+ *
+ * this reduces implementation overhead and perfectly forwards all arguments
+ */
+template <typename ExecPolicy, typename... Args,
+          typename Res = typename resources::get_resource<ExecPolicy>::type>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>>
+exclusive_segmented_scan(Args&&... args)
+{
+  Res r = Res::get_default();
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan<ExecPolicy>(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+///
+template <typename ExecPolicy, typename Res, typename... Args>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<Res>,
+                      type_traits::is_execution_policy<ExecPolicy>,
+                      type_traits::is_resource<Res>>
+exclusive_segmented_scan(Res r, Args&&... args)
+{
+  return ::RAJA::policy_by_value_interface::exclusive_segmented_scan(
+      ExecPolicy(), r, std::forward<Args>(args)...);
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
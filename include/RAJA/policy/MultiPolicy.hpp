@@ -20,6 +20,7 @@
 
 #include "RAJA/config.hpp"
 
+#include <iterator>
 #include <tuple>
 
 #include "RAJA/policy/PolicyBase.hpp"
@@ -173,22 +174,27 @@ struct policy_invoker : public policy_invoker<index - 1, size, rest...> {
   {
     if (offset == size - index - 1) {
 
-      util::PluginContext context{util::make_context<Policy>()};
-      util::callPreCapturePlugins(context);
+      const bool use_plugins = util::plugins_active();
+      util::PluginContext context{use_plugins ?
+          util::make_context<Policy, camp::decay<LoopBody>>(
+              nullptr,
+              static_cast<size_t>(std::distance(std::begin(iter), std::end(iter))))
+          : util::PluginContext{Platform::undefined}};
+      if (use_plugins) { util::callPreCapturePlugins(context); }
 
       using RAJA::util::trigger_updates_before;
       auto body = trigger_updates_before(loop_body);
 
-      util::callPostCapturePlugins(context);
+      if (use_plugins) { util::callPostCapturePlugins(context); }
 
-      util::callPreLaunchPlugins(context);
+      if (use_plugins) { util::callPreLaunchPlugins(context); }
 
       using policy::multi::forall_impl;
       RAJA_FORCEINLINE_RECURSIVE
       auto r = resources::get_resource<Policy>::type::get_default();
       forall_impl(r, _p, std::forward<Iterable>(iter), body);
 
-      util::callPostLaunchPlugins(context);
+      if (use_plugins) { util::callPostLaunchPlugins(context); }
     } else {
       NextInvoker::invoke(offset, std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
     }
@@ -204,15 +210,20 @@ struct policy_invoker<0, size, Policy, rest...> {
   {
     if (offset == size - 1) {
 
-      util::PluginContext context{util::make_context<Policy>()};
-      util::callPreCapturePlugins(context);
+      const bool use_plugins = util::plugins_active();
+      util::PluginContext context{use_plugins ?
+          util::make_context<Policy, camp::decay<LoopBody>>(
+              nullptr,
+              static_cast<size_t>(std::distance(std::begin(iter), std::end(iter))))
+          : util::PluginContext{Platform::undefined}};
+      if (use_plugins) { util::callPreCapturePlugins(context); }
 
       using RAJA::util::trigger_updates_before;
       auto body = trigger_updates_before(loop_body);
 
-      util::callPostCapturePlugins(context);
+      if (use_plugins) { util::callPostCapturePlugins(context); }
 
-      util::callPreLaunchPlugins(context);
+      if (use_plugins) { util::callPreLaunchPlugins(context); }
 
       //std::cout <<"policy_invoker: No index\n";
       using policy::multi::forall_impl;
@@ -220,7 +231,7 @@ struct policy_invoker<0, size, Policy, rest...> {
       auto r = resources::get_resource<Policy>::type::get_default();
       forall_impl(r, _p, std::forward<Iterable>(iter), body);
 
-      util::callPostLaunchPlugins(context);
+      if (use_plugins) { util::callPostLaunchPlugins(context); }
     } else {
       throw std::runtime_error("unknown offset invoked");
     }
@@ -34,7 +34,8 @@ enum class Policy {
   target_openmp,
   cuda,
   hip,
-  sycl
+  sycl,
+  thread_pool
 };
 
 enum class Pattern {
@@ -192,6 +193,10 @@ struct is_hip_policy : RAJA::policy_is<Pol, RAJA::Policy::hip> {
 template <typename Pol>
 struct is_sycl_policy : RAJA::policy_is<Pol, RAJA::Policy::sycl> {
 };
+template <typename Pol>
+struct is_thread_pool_policy
+    : RAJA::policy_is<Pol, RAJA::Policy::thread_pool> {
+};
 
 template <typename Pol>
 struct is_device_exec_policy
@@ -35,6 +35,7 @@
 
 #include "RAJA/policy/openmp/forall.hpp"
 #include "RAJA/policy/openmp/kernel.hpp"
+#include "RAJA/policy/openmp/numa.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/openmp/reduce.hpp"
 #include "RAJA/policy/openmp/region.hpp"
@@ -20,6 +20,16 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <omp.h>
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/pattern/detail/algorithm.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
@@ -81,6 +91,194 @@ struct WorkRunner<
         Args...>
 { };
 
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * as part of a fused iteration space, a call runs the iterations in
+ * [i_begin, i_end) of this loop
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpFusedLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpFusedLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()(index_type i_begin, index_type i_end,
+                              Args... args) const
+  {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(m_body);
+    const auto begin = m_segment.begin();
+    for ( index_type i = i_begin; i < i_end; ++i ) {
+      body.get_priv()(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Runs work in a storage container out of order in a single parallel
+ * region. The iterations of all the loops form one iteration space that is
+ * split evenly between the threads, each thread finds the loop containing
+ * its first iteration with a binary search over the loop offsets.
+ */
+template <typename DISPATCH_POLICY_T,
+          typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_fused_iteration_space,
+        DISPATCH_POLICY_T,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::omp_work;
+  using order_policy = RAJA::policy::omp::unordered_omp_fused_iteration_space;
+  using dispatch_policy = DISPATCH_POLICY_T;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  // The type that will hold the segment and loop body in work storage
+  struct holder_type {
+    template < typename T >
+    using type = HoldOmpFusedLoop<
+        typename camp::at<T, camp::num<0>>::type, // ITERABLE
+        typename camp::at<T, camp::num<1>>::type, // LOOP_BODY
+        index_type, Args...>;
+  };
+  ///
+  template < typename T >
+  using holder_type_t = typename holder_type::template type<T>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host in a parallel region
+  using dispatcher_exec_policy = exec_policy;
+
+  // The Dispatcher policy with holder_types used internally to handle the
+  // ranges and callables passed in by the user.
+  using dispatcher_holder_policy = dispatcher_transform_types_t<dispatch_policy, holder_type>;
+
+  using dispatcher_type = Dispatcher<Platform::host, dispatcher_holder_policy, void, index_type, index_type, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner && o)
+    : m_offsets(std::move(o.m_offsets))
+  {
+    o.m_offsets.clear();
+  }
+  WorkRunner& operator=(WorkRunner && o)
+  {
+    m_offsets = std::move(o.m_offsets);
+
+    o.m_offsets.clear();
+    return *this;
+  }
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type_t<camp::list<ITERABLE, LOOP_BODY>>;
+
+    const index_type len = static_cast<index_type>(
+        std::distance(std::begin(iter), std::end(iter)));
+
+    // Only store loops that have something to iterate over
+    if (len > 0) {
+
+      if (m_offsets.empty()) {
+        m_offsets.emplace_back(0);
+      }
+      m_offsets.emplace_back(m_offsets.back() + len);
+
+      storage.template emplace<holder>(
+          get_Dispatcher<holder, dispatcher_type>(dispatcher_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+    using RAJA::detail::firstIndex;
+
+    per_run_storage run_storage{};
+
+    const auto begin = storage.begin();
+    const auto num_loops = std::distance(begin, storage.end());
+
+    // Only enter the parallel region if we have something to iterate over
+    if (num_loops > 0) {
+
+      const index_type* offsets = m_offsets.data();
+      const index_type num_iterations = offsets[num_loops];
+
+      RAJA_FT_BEGIN;
+
+#pragma omp parallel
+      {
+        const int p = omp_get_num_threads();
+        const int pid = omp_get_thread_num();
+        index_type i = firstIndex(num_iterations, p, pid);
+        const index_type i_end = firstIndex(num_iterations, p, pid + 1);
+
+        if (i < i_end) {
+          // find the loop containing this thread's first iteration
+          auto loop = std::upper_bound(offsets, offsets + num_loops, i)
+                      - offsets - 1;
+
+          while (i < i_end) {
+            const index_type loop_end = std::min(offsets[loop + 1], i_end);
+            value_type::host_call(&begin[loop],
+                                  i - offsets[loop],
+                                  loop_end - offsets[loop],
+                                  args...);
+            i = loop_end;
+            ++loop;
+          }
+        }
+      }
+
+      RAJA_FT_END;
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_offsets.clear();
+  }
+
+private:
+  // offsets of the first iteration of each loop in the combined
+  // iteration space followed by the total number of iterations
+  std::vector<index_type> m_offsets;
+};
+
 }  // namespace detail
 
 }  // namespace RAJA
@@ -39,6 +39,7 @@
 #include "RAJA/index/RangeSegment.hpp"
 
 #include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/numa.hpp"
 
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
@@ -329,6 +330,39 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP parallel policy with the iterations partitioned by NUMA node
+///
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_numa_static_exec&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  auto const& partition = numa::Partition::get(omp_get_max_threads());
+
+  RAJA_EXTRACT_BED_IT(iter);
+  #pragma omp parallel num_threads(partition.numThreads())
+  {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+
+    decltype(distance_it) begin = 0;
+    decltype(distance_it) end = 0;
+    numa::team_range(partition, distance_it, begin, end);
+    for (decltype(distance_it) i = begin; i < end; ++i) {
+      body.get_priv()(begin_it[i]);
+    }
+  }
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 //
 //////////////////////////////////////////////////////////////////////
 //
@@ -339,6 +373,44 @@ forall_impl(resources::Host host_res,
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
+  /*!
+   * \brief  Execute one segment of a dependency graph: wait for its
+   *         predecessors, run it, ready it for the next execution and
+   *         notify its dependent segments.
+   */
+  template <typename... SegmentTypes, typename Func>
+  RAJA_INLINE void taskgraph_execute(const TypedIndexSet<SegmentTypes...>& iset,
+                                     int segid,
+                                     Func&& loop_body)
+  {
+    DepGraphNode* task = iset.getDepGraphNode(segid);
+
+    task->wait();
+
+    loop_body(segid);
+
+    task->reset();
+
+    for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+      iset.getDepGraphNode(task->depTaskNum(ii))->satisfyOne();
+    }
+  }
+
+  template <typename... SegmentTypes>
+  RAJA_INLINE void taskgraph_check(const TypedIndexSet<SegmentTypes...>& iset)
+  {
+    if (!iset.dependencyGraphSet()) {
+      std::cerr << "\n RAJA IndexSet dependency graph not set , "
+                << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
+      RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+    }
+  }
+
+} // end namespace internal
+
 /*!
  ******************************************************************************
  *
@@ -347,59 +419,82 @@ forall_impl(resources::Host host_res,
  *         execution policy template parameter.
  *
  *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         properly set up for each segment in the index set. Segments are
+ *         dealt to threads round-robin, so a segment that must wait before
+ *         its first execution may only depend on lower numbered segments.
  *
  ******************************************************************************
  */
-
-/*
- * TODO: Fix this!!!
- */
-
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+template <typename... SegmentTypes, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskgraph_segit&,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            Func&& loop_body,
+            ForallParam)
 {
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
-  }
+  internal::taskgraph_check(iset);
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+  const int num_seg = iset.getNumSegments();
 
-  int num_seg = ncis.getNumSegments();
-
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    #pragma omp for schedule(static, 1)
+    for (int isi = 0; isi < num_seg; ++isi) {
+      internal::taskgraph_execute(iset, isi, body.get_priv());
+    }
+  });
 
-    task->wait();
+  return resources::EventProxy<resources::Host>(host_res);
+}
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using an omp parallel region and
+ *         segment dependency graph, where each thread executes the segment
+ *         intervals set with TypedIndexSet::setSegmentInterval in order.
+ *         Interval i is executed by thread i modulo the number of threads.
+ *
+ ******************************************************************************
+ */
+template <typename... SegmentTypes, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const omp_taskgraph_interval_segit&,
+            const TypedIndexSet<SegmentTypes...>& iset,
+            Func&& loop_body,
+            ForallParam)
+{
+  internal::taskgraph_check(iset);
 
-    task->reset();
+  const int num_intervals = static_cast<int>(iset.getNumSegmentIntervals());
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+    const int num_threads = omp_get_num_threads();
+    for (int interval = omp_get_thread_num(); interval < num_intervals;
+         interval += num_threads) {
+      const int seg_end = iset.getSegmentIntervalEnd(interval);
+      for (int isi = iset.getSegmentIntervalBegin(interval); isi < seg_end;
+           ++isi) {
+        internal::taskgraph_execute(iset, isi, body.get_priv());
       }
     }
+  });
 
-  }  // iterate over segments of index set
+  return resources::EventProxy<resources::Host>(host_res);
 }
-*/
 
 }  // namespace omp
 
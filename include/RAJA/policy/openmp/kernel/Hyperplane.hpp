@@ -0,0 +1,235 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for the OpenMP doacross hyperplane executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Hyperplane_HPP
+#define RAJA_policy_openmp_kernel_Hyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * HpExecPolicy for statement::Hyperplane that runs the wavefront as a
+ * pipeline of tiles instead of one parallel loop per hyperplane.
+ *
+ * The iteration space of the hyperplane arguments is cut into tiles of
+ * TileSize iterates in each dimension. Threads of an OpenMP parallel region
+ * take tiles in order of their tile hyperplane and each tile starts as soon
+ * as its upstream neighbor in every dimension is done, so there is no
+ * barrier between hyperplanes. Iterates of a tile run sequentially in
+ * lexicographic order and the ExecPolicy of the statement is not used.
+ *
+ * The loop body may only depend on iterates that are not greater in any
+ * hyperplane argument, e.g. (i-1, j) and (i, j-1) in a 2D sweep, which is
+ * what a doacross loop with depend(sink) on those neighbors allows.
+ */
+template <camp::idx_t TileSize = 32>
+struct omp_hyperplane_doacross_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::Parallel> {
+  static_assert(TileSize > 0, "TileSize must be positive");
+};
+
+namespace internal
+{
+
+// Types with the segment type of each of Args set
+template <typename Types, typename Data, camp::idx_t... Args>
+struct HyperplaneDoacrossTypes {
+  using type = Types;
+};
+
+template <typename Types, typename Data, camp::idx_t Arg0, camp::idx_t... Args>
+struct HyperplaneDoacrossTypes<Types, Data, Arg0, Args...> {
+  using type = typename HyperplaneDoacrossTypes<
+      setSegmentTypeFromData<Types, Arg0, Data>,
+      Data,
+      Args...>::type;
+};
+
+template <typename Data, camp::idx_t... ArgIds, camp::idx_t... Pos>
+RAJA_INLINE void hyperplane_doacross_assign(Data& data,
+                                            ArgList<ArgIds...>,
+                                            camp::idx_seq<Pos...>,
+                                            Index_type const* idx)
+{
+  using offset_tuple_t = typename camp::decay<Data>::offset_tuple_t;
+  camp::sink((data.template assign_offset<ArgIds>(
+                  static_cast<camp::tuple_element_t<ArgIds, offset_tuple_t>>(
+                      idx[Pos])),
+              0)...);
+}
+
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t TileSize,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Hyperplane<HpArgumentId,
+                          omp_hyperplane_doacross_exec<TileSize>,
+                          ArgList<Args...>,
+                          ExecPolicy,
+                          EnclosedStmts...>,
+    Types> {
+
+  static constexpr int num_dims = 1 + sizeof...(Args);
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data& data)
+  {
+    using arg_list = ArgList<HpArgumentId, Args...>;
+    using NewTypes =
+        typename HyperplaneDoacrossTypes<Types, Data, HpArgumentId, Args...>::
+            type;
+
+    const Index_type len[num_dims] = {
+        static_cast<Index_type>(segment_length<HpArgumentId>(data)),
+        static_cast<Index_type>(segment_length<Args>(data))...};
+
+    // tiles are numbered row-major, tile t has predecessor t - stride[d]
+    // in each dimension d where its tile coordinate is not 0
+    Index_type num_tiles[num_dims];
+    Index_type stride[num_dims];
+    Index_type total = 1;
+    Index_type num_planes = 1;
+    for (int d = num_dims - 1; d >= 0; --d) {
+      if (len[d] <= 0) {
+        return;
+      }
+      num_tiles[d] = (len[d] + TileSize - 1) / TileSize;
+      stride[d] = total;
+      total *= num_tiles[d];
+      num_planes += num_tiles[d] - 1;
+    }
+
+    // order tiles by tile hyperplane with a counting sort
+    std::vector<Index_type> plane_begin(num_planes + 1, 0);
+    for (Index_type t = 0; t < total; ++t) {
+      ++plane_begin[tile_plane(t, num_tiles, stride) + 1];
+    }
+    for (Index_type p = 0; p < num_planes; ++p) {
+      plane_begin[p + 1] += plane_begin[p];
+    }
+    std::vector<Index_type> order(total);
+    for (Index_type t = 0; t < total; ++t) {
+      order[plane_begin[tile_plane(t, num_tiles, stride)]++] = t;
+    }
+
+    std::unique_ptr<std::atomic<int>[]> done(new std::atomic<int>[total]);
+    for (Index_type t = 0; t < total; ++t) {
+      done[t].store(0, std::memory_order_relaxed);
+    }
+
+    // tiles are handed out in order, so a thread only ever waits on tiles
+    // already taken by threads that make progress
+    std::atomic<Index_type> next{0};
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+
+      Index_type n;
+      while ((n = next.fetch_add(1, std::memory_order_relaxed)) < total) {
+        const Index_type tile = order[n];
+
+        Index_type lo[num_dims];
+        Index_type hi[num_dims];
+        for (int d = 0; d < num_dims; ++d) {
+          const Index_type t = (tile / stride[d]) % num_tiles[d];
+          if (t > 0) {
+            std::atomic<int> const& upstream = done[tile - stride[d]];
+            while (upstream.load(std::memory_order_acquire) == 0) {
+              std::this_thread::yield();
+            }
+          }
+          lo[d] = t * TileSize;
+          hi[d] = lo[d] + TileSize < len[d] ? lo[d] + TileSize : len[d];
+        }
+
+        Index_type idx[num_dims];
+        for (int d = 0; d < num_dims; ++d) {
+          idx[d] = lo[d];
+        }
+        while (true) {
+          hyperplane_doacross_assign(private_data,
+                                     arg_list{},
+                                     camp::make_idx_seq_t<num_dims>{},
+                                     idx);
+          execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+              private_data);
+
+          int d = num_dims - 1;
+          for (; d >= 0; --d) {
+            if (++idx[d] < hi[d]) {
+              break;
+            }
+            idx[d] = lo[d];
+          }
+          if (d < 0) {
+            break;
+          }
+        }
+
+        done[tile].store(1, std::memory_order_release);
+      }
+    }
+  }
+
+private:
+  static RAJA_INLINE Index_type tile_plane(Index_type tile,
+                                           Index_type const* num_tiles,
+                                           Index_type const* stride)
+  {
+    Index_type plane = 0;
+    for (int d = 0; d < num_dims; ++d) {
+      plane += (tile / stride[d]) % num_tiles[d];
+    }
+    return plane;
+  }
+};
+
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -18,6 +18,7 @@
 #ifndef RAJA_pattern_launch_openmp_HPP
 #define RAJA_pattern_launch_openmp_HPP
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/pattern/launch/launch_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
@@ -39,11 +40,12 @@ struct LaunchExecute<RAJA::omp_launch_t> {
         using RAJA::internal::thread_privatize;
         auto loop_body = thread_privatize(body);
 
-        ctx.shared_mem_ptr = (char*) malloc(params.shared_mem_size);
+        // reuse this thread's scratch buffer across launches
+        ThreadScratch scratch(params.shared_mem_size);
+        ctx.shared_mem_ptr = scratch.get();
 
         loop_body.get_priv()(ctx);
 
-        free(ctx.shared_mem_ptr);
         ctx.shared_mem_ptr = nullptr;
     });
 
@@ -0,0 +1,287 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the NUMA topology and the iteration partition
+ *          used by the omp_numa_static_exec policy and
+ *          RAJA::numa_first_touch_fill.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_numa_HPP
+#define RAJA_policy_openmp_numa_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <sched.h>
+#endif
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace omp
+{
+namespace numa
+{
+
+/*!
+ * \brief NUMA node of each cpu, read once from /sys/devices/system/node.
+ *
+ * Machines without that directory are treated as a single node.
+ */
+class Topology
+{
+public:
+  static Topology const& get()
+  {
+    static const Topology topology;
+    return topology;
+  }
+
+  int numNodes() const { return m_num_nodes; }
+
+  int nodeOfCpu(int cpu) const
+  {
+    if (cpu < 0 || static_cast<size_t>(cpu) >= m_node_of_cpu.size()) {
+      return 0;
+    }
+    return m_node_of_cpu[cpu];
+  }
+
+  //! NUMA node of the cpu the calling thread runs on
+  int nodeOfThisThread() const
+  {
+#if defined(__linux__)
+    return nodeOfCpu(sched_getcpu());
+#else
+    return 0;
+#endif
+  }
+
+private:
+  Topology()
+  {
+#if defined(__linux__)
+    DIR* dir = opendir("/sys/devices/system/node");
+    if (dir != nullptr) {
+      std::vector<int> nodes;
+      while (struct dirent* entry = readdir(dir)) {
+        int node = 0;
+        char rest = '\0';
+        if (std::sscanf(entry->d_name, "node%d%c", &node, &rest) == 1) {
+          nodes.push_back(node);
+        }
+      }
+      closedir(dir);
+
+      // renumber nodes densely, node directories may have gaps
+      std::sort(nodes.begin(), nodes.end());
+      for (size_t n = 0; n < nodes.size(); ++n) {
+        const std::string path = "/sys/devices/system/node/node" +
+                                 std::to_string(nodes[n]) + "/cpulist";
+        readCpuList(path, static_cast<int>(n));
+      }
+      if (!nodes.empty()) {
+        m_num_nodes = static_cast<int>(nodes.size());
+      }
+    }
+#endif
+  }
+
+  // parse a cpu list like "0-15,32-47"
+  void readCpuList(std::string const& path, int node)
+  {
+    FILE* file = std::fopen(path.c_str(), "r");
+    if (file == nullptr) {
+      return;
+    }
+    int first = 0;
+    while (std::fscanf(file, "%d", &first) == 1) {
+      int last = first;
+      int c = std::fgetc(file);
+      if (c == '-') {
+        if (std::fscanf(file, "%d", &last) != 1) {
+          break;
+        }
+        c = std::fgetc(file);
+      }
+      if (last >= 0 && static_cast<size_t>(last) >= m_node_of_cpu.size()) {
+        m_node_of_cpu.resize(last + 1, 0);
+      }
+      for (int cpu = first; cpu <= last; ++cpu) {
+        m_node_of_cpu[cpu] = node;
+      }
+      if (c != ',') {
+        break;
+      }
+    }
+    std::fclose(file);
+  }
+
+  int m_num_nodes = 1;
+  std::vector<int> m_node_of_cpu;
+};
+
+/*!
+ * \brief Partition of loop iterations between the threads of a team.
+ *
+ * Threads are ranked by (NUMA node, thread number) and rank r gets the r-th
+ * of num_threads contiguous equal blocks, so each node owns one contiguous
+ * part of the iteration space and each thread owns the same block of every
+ * loop of the same length. The node of each thread is found once per team
+ * size, so threads should be bound to cores (OMP_PROC_BIND) for the
+ * partition to follow the sockets.
+ */
+class Partition
+{
+public:
+  //! Partition of a team of num_threads threads
+  static Partition const& get(int num_threads)
+  {
+    static thread_local Partition const* last = nullptr;
+    if (last != nullptr && last->numThreads() == num_threads) {
+      return *last;
+    }
+
+    static std::mutex mutex;
+    static std::map<int, std::unique_ptr<Partition>> partitions;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<Partition>& partition = partitions[num_threads];
+    if (!partition) {
+      partition.reset(new Partition(num_threads));
+    }
+    last = partition.get();
+    return *partition;
+  }
+
+  int numThreads() const { return static_cast<int>(m_rank_of_thread.size()); }
+
+  int rankOfThread(int thread) const { return m_rank_of_thread[thread]; }
+
+  //! First and last (exclusive) iteration of a thread of the team
+  template <typename Index>
+  void range(int thread, Index len, Index& begin, Index& end) const
+  {
+    const Index num_threads = static_cast<Index>(numThreads());
+    const Index rank = static_cast<Index>(rankOfThread(thread));
+    const Index base = len / num_threads;
+    const Index extra = len % num_threads;
+    begin = rank * base + (rank < extra ? rank : extra);
+    end = begin + base + (rank < extra ? 1 : 0);
+  }
+
+private:
+  explicit Partition(int num_threads)
+      : m_rank_of_thread(num_threads > 0 ? num_threads : 1, 0)
+  {
+    const int team = static_cast<int>(m_rank_of_thread.size());
+    std::vector<int> node_of_thread(team, 0);
+
+    Topology const& topology = Topology::get();
+    if (topology.numNodes() > 1) {
+#pragma omp parallel num_threads(team)
+      {
+        const int t = omp_get_thread_num();
+        if (t < team) {
+          node_of_thread[t] = topology.nodeOfThisThread();
+        }
+      }
+    }
+
+    std::vector<int> order(team);
+    for (int t = 0; t < team; ++t) {
+      order[t] = t;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+      return node_of_thread[a] < node_of_thread[b];
+    });
+    for (int r = 0; r < team; ++r) {
+      m_rank_of_thread[order[r]] = r;
+    }
+  }
+
+  std::vector<int> m_rank_of_thread;
+};
+
+/*!
+ * \brief Iterations [begin, end) of len owned by the calling thread of a
+ *        parallel region opened with partition.numThreads() threads.
+ *
+ * If the region got fewer threads than asked for, thread 0 runs all of
+ * the iterations.
+ */
+template <typename Index>
+RAJA_INLINE void team_range(Partition const& partition,
+                            Index len,
+                            Index& begin,
+                            Index& end)
+{
+  if (omp_get_num_threads() == partition.numThreads()) {
+    partition.range(omp_get_thread_num(), len, begin, end);
+  } else {
+    begin = 0;
+    end = omp_get_thread_num() == 0 ? len : 0;
+  }
+}
+
+}  // namespace numa
+}  // namespace omp
+}  // namespace policy
+
+/*!
+ * \brief Write value to ptr[0, len) with the partition of
+ *        omp_numa_static_exec, so that each page is first touched, and
+ *        placed, on the NUMA node of the threads that own it in later
+ *        omp_numa_static_exec loops over the same length.
+ */
+template <typename T>
+void numa_first_touch_fill(T* ptr, size_t len, T const& value)
+{
+  auto const& partition =
+      policy::omp::numa::Partition::get(omp_get_max_threads());
+  const int num_threads = partition.numThreads();
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    size_t begin = 0;
+    size_t end = 0;
+    policy::omp::numa::team_range(partition, len, begin, end);
+    for (size_t i = begin; i < end; ++i) {
+      ptr[i] = value;
+    }
+  }
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_OPENMP)
+
+#endif  // closing endif for header file include guard
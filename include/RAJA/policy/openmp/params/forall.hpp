@@ -8,11 +8,14 @@
 #ifndef RAJA_forall_param_openmp_HPP
 #define RAJA_forall_param_openmp_HPP
 
+// Private copies of the params are copied from the initialized params, so
+// params that need more than their default state, like the size of an
+// ArrayReducer, have it in every thread.
 #define RAJA_OMP_DECLARE_REDUCTION_COMBINE \
       _Pragma(" omp declare reduction( combine \
         : typename std::remove_reference<decltype(f_params)>::type \
-        : RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(omp_out, omp_in) ) ")\
-        //initializer(omp_priv = omp_in) ")
+        : RAJA::expt::ParamMultiplexer::combine<EXEC_POL>(omp_out, omp_in) ) \
+        initializer(omp_priv = omp_orig) ")
 
 namespace RAJA
 {
@@ -324,6 +327,42 @@ forall_impl(resources::Host host_res,
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+///
+/// OpenMP parallel policy with the iterations partitioned by NUMA node
+///
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE
+concepts::enable_if_t<
+  resources::EventProxy<resources::Host>,
+  RAJA::expt::type_traits::is_ForallParamPack<ForallParam>,
+  concepts::negate<RAJA::expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const omp_numa_static_exec& p,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  using EXEC_POL = typename std::decay<decltype(p)>::type;
+  RAJA::expt::ParamMultiplexer::init<EXEC_POL>(f_params);
+  RAJA_OMP_DECLARE_REDUCTION_COMBINE;
+
+  auto const& partition = numa::Partition::get(omp_get_max_threads());
+
+  RAJA_EXTRACT_BED_IT(iter);
+  #pragma omp parallel num_threads(partition.numThreads()) reduction(combine : f_params)
+  {
+    decltype(distance_it) begin = 0;
+    decltype(distance_it) end = 0;
+    numa::team_range(partition, distance_it, begin, end);
+    for (decltype(distance_it) i = begin; i < end; ++i) {
+      RAJA::expt::invoke_body(f_params, loop_body, begin_it[i]);
+    }
+  }
+
+  RAJA::expt::ParamMultiplexer::resolve<EXEC_POL>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace omp
 
 }  // namespace policy
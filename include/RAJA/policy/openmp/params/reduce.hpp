@@ -3,6 +3,10 @@
 
 #include "RAJA/pattern/params/reducer.hpp"
 
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
 namespace RAJA {
 namespace expt {
 namespace detail {
@@ -30,6 +34,52 @@ namespace detail {
     *red.target = OP{}(red.val, *red.target);
   }
 
+  // Init, private copies of the reducer take a slot each
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  init(ArrayReducer<OP, T>& red) {
+    red.bins.assign(red.size, OP::identity());
+    red.val = red.bins.data();
+    red.slots = std::make_shared<ArrayReducerSlots<T>>(red.size, omp_get_max_threads());
+  }
+
+  // Combine, only copies that did not get a slot hold an array of their own
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  combine(ArrayReducer<OP, T>& out, const ArrayReducer<OP, T>& in) {
+    if (in.val == in.bins.data()) {
+      for (size_t i = 0; i < in.size; ++i) {
+        out.val[i] = OP{}(out.val[i], in.val[i]);
+      }
+    }
+  }
+
+  // Resolve, merges the slots with the threads splitting the array in blocks
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< type_traits::is_openmp_policy<EXEC_POL> >
+  resolve(ArrayReducer<OP, T>& red) {
+    constexpr std::ptrdiff_t block_size = 1024;
+    const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(red.size);
+    const size_t num_slots = red.slots->num_claimed();
+    ArrayReducerSlots<T>& slots = *red.slots;
+
+    #pragma omp parallel for schedule(static) if(size > block_size)
+    for (std::ptrdiff_t b = 0; b < size; b += block_size) {
+      const std::ptrdiff_t e = b + block_size < size ? b + block_size : size;
+      for (size_t s = 0; s < num_slots; ++s) {
+        const T* part = slots.slot(s);
+        for (std::ptrdiff_t i = b; i < e; ++i) {
+          red.val[i] = OP{}(red.val[i], part[i]);
+        }
+      }
+      for (std::ptrdiff_t i = b; i < e; ++i) {
+        red.target[i] = OP{}(red.val[i], red.target[i]);
+      }
+    }
+
+    red.slots.reset();
+  }
+
 #endif
 
 } //  namespace detail
@@ -225,6 +225,21 @@ using omp_parallel_for_guided_exec = omp_parallel_exec<omp_for_schedule_exec<omp
 using omp_parallel_for_runtime_exec = omp_parallel_exec<omp_for_schedule_exec<omp::Runtime>>;
 
 
+///
+///  Struct supporting OpenMP 'parallel' with the iterations split into
+///  contiguous blocks by NUMA node and thread, so that a thread owns the
+///  same block in every loop of the same length. The split is the one used
+///  by RAJA::numa_first_touch_fill (see RAJA/policy/openmp/numa.hpp).
+///
+struct omp_numa_static_exec
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
+};
+
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -246,12 +261,20 @@ using omp_parallel_segit = omp_parallel_for_segit;
 ///////////////////////////////////////////////////////////////////////
 ///
 struct omp_taskgraph_segit
-    : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::taskgraph,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
 };
 
 ///
 struct omp_taskgraph_interval_segit
-    : make_policy_pattern_t<Policy::openmp, Pattern::taskgraph, omp::Parallel> {
+    : make_policy_pattern_launch_platform_t<Policy::openmp,
+                                            Pattern::taskgraph,
+                                            Launch::undefined,
+                                            Platform::host,
+                                            omp::Parallel> {
 };
 
 
@@ -268,6 +291,15 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+/// execute the enqueued loops in an unordered fashion in a single parallel
+/// region by splitting the combined iterations of all the loops evenly
+/// between the threads
+struct unordered_omp_fused_iteration_space
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -283,6 +315,16 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+struct omp_reduce_padded
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
+///
+struct omp_reduce_repro
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
 ///
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
@@ -329,6 +371,8 @@ using policy::omp::omp_parallel_for_dynamic_exec;
 using policy::omp::omp_parallel_for_guided_exec;
 ///
 using policy::omp::omp_parallel_for_runtime_exec;
+///
+using policy::omp::omp_numa_static_exec;
 
 ///
 /// Type aliases for omp parallel for iteration over indexset segments
@@ -337,6 +381,13 @@ using policy::omp::omp_parallel_for_segit;
 ///
 using policy::omp::omp_parallel_segit;
 
+///
+/// Type aliases for omp dependency graph iteration over indexset segments
+///
+using policy::omp::omp_taskgraph_segit;
+///
+using policy::omp::omp_taskgraph_interval_segit;
+
 ///
 /// Type alias for omp parallel region containing an inner 'omp for' loop 
 /// execution policy. Inner policy types follow.
@@ -389,6 +440,10 @@ using policy::omp::omp_launch_t;
 using policy::omp::omp_reduce;
 ///
 using policy::omp::omp_reduce_ordered;
+///
+using policy::omp::omp_reduce_padded;
+///
+using policy::omp::omp_reduce_repro;
 
 ///
 /// Type aliases for omp reductions
@@ -397,6 +452,8 @@ using policy::omp::omp_synchronize;
 
 ///
 using policy::omp::omp_work;
+///
+using policy::omp::unordered_omp_fused_iteration_space;
 
 }  // namespace RAJA
 
@@ -25,11 +25,15 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
+#include <cstdint>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 #include <omp.h>
 
+#include "RAJA/util/ReproSum.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "RAJA/pattern/detail/reduce.hpp"
@@ -124,6 +128,215 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce_ordered, detail::ReduceOMPOrdered)
 
+///////////////////////////////////////////////////////////////////////////////
+//
+// Padded per-thread reductions are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+/*!
+ * \brief One value per OpenMP thread, each on its own cache lines so that
+ *        threads publishing their partial results do not false-share.
+ */
+template <typename T>
+class OMPPaddedSlots
+{
+  static constexpr size_t stride =
+      ((sizeof(T) + cache_line_size - 1) / cache_line_size) * cache_line_size;
+
+  std::unique_ptr<char[]> storage;
+  char* base;
+  int num_slots;
+
+public:
+  OMPPaddedSlots(int num_slots_, T const& value)
+      : storage(new char[num_slots_ * stride + cache_line_size]),
+        num_slots(num_slots_)
+  {
+    // operator new[] only guarantees fundamental alignment
+    const size_t offset =
+        reinterpret_cast<std::uintptr_t>(storage.get()) % cache_line_size;
+    base = storage.get() + (offset ? cache_line_size - offset : 0);
+    for (int i = 0; i < num_slots; ++i) {
+      new (base + i * stride) T(value);
+    }
+  }
+
+  OMPPaddedSlots(OMPPaddedSlots const&) = delete;
+  OMPPaddedSlots& operator=(OMPPaddedSlots const&) = delete;
+
+  ~OMPPaddedSlots()
+  {
+    for (int i = 0; i < num_slots; ++i) {
+      (*this)[i].~T();
+    }
+  }
+
+  int size() const { return num_slots; }
+
+  T& operator[](int i) const
+  {
+    return *reinterpret_cast<T*>(base + i * stride);
+  }
+};
+
+/*!
+ * \brief Reducer that never takes a lock. Each thread folds its private copy
+ *        into its own padded slot, and get() combines the slots pairwise in a
+ *        tree so the combination order only depends on the number of slots.
+ *
+ *        Like ReduceOMPOrdered, the number of slots is taken from
+ *        omp_get_max_threads() when the reducer is constructed or reset.
+ */
+template <typename T, typename Reduce>
+class ReduceOMPPadded
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPPadded<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPPadded>;
+  std::shared_ptr<OMPPaddedSlots<T>> data;
+
+public:
+  ReduceOMPPadded() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPPadded(T init_val, T identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    data = std::make_shared<OMPPaddedSlots<T>>(omp_get_max_threads(),
+                                               identity_);
+  }
+
+  ~ReduceOMPPadded()
+  {
+    if (Base::parent) {
+      Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    OMPPaddedSlots<T>& slots = *data;
+    const int num_slots = slots.size();
+
+    if (Base::my_data != Base::identity) {
+      Reduce{}(slots[0], Base::my_data);
+      Base::my_data = Base::identity;
+    }
+
+    // pairwise tree combine; slot 0 keeps the result for later calls
+    for (int offset = 1; offset < num_slots; offset *= 2) {
+      for (int i = 0; i + offset < num_slots; i += 2 * offset) {
+        Reduce{}(slots[i], slots[i + offset]);
+        slots[i + offset] = Base::identity;
+      }
+    }
+    return slots[0];
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_padded, detail::ReduceOMPPadded)
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reproducible sum reductions are included below.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+/*!
+ * \brief Sum reducer whose result does not depend on the number of threads
+ *        or on how iterations are assigned to them. Each copy accumulates
+ *        into a ReproSum, folds it into the padded slot of its thread when
+ *        it is destroyed, and get() merges the slots exactly and rounds the
+ *        total once.
+ *
+ *        The identity is always zero.
+ */
+template <typename T, typename Reduce>
+class ReduceOMPReproSum
+{
+  using Slots = OMPPaddedSlots<ReproSum<T>>;
+
+  ReduceOMPReproSum const* parent = nullptr;
+  T init;
+  std::shared_ptr<Slots> data;
+  ReproSum<T> mutable my_data;
+
+public:
+  ReduceOMPReproSum() { reset(T(), T()); }
+
+  //! constructor requires a default value for the reducer
+  explicit ReduceOMPReproSum(T init_val, T identity_)
+  {
+    reset(init_val, identity_);
+  }
+
+  ReduceOMPReproSum(ReduceOMPReproSum const& other)
+      : parent{other.parent ? other.parent : &other},
+        init{other.init},
+        data{other.data}
+  {
+  }
+
+  ~ReduceOMPReproSum()
+  {
+    if (parent) {
+      (*data)[omp_get_thread_num()] += my_data;
+    }
+  }
+
+  void reset(T init_val, T)
+  {
+    init = init_val;
+    my_data = ReproSum<T>();
+    data = std::make_shared<Slots>(omp_get_max_threads(), ReproSum<T>());
+  }
+
+  void combine(T const& other) { my_data += other; }
+
+  T get() const
+  {
+    ReproSum<T> total(init);
+    total += my_data;
+    for (int i = 0; i < data->size(); ++i) {
+      total += (*data)[i];
+    }
+    return total.get();
+  }
+};
+
+//! Reproducible sums of floating point values, integer sums are exact
+//! with any order
+template <typename T, typename Reduce>
+using ReduceOMPRepro =
+    typename std::conditional<std::is_floating_point<T>::value,
+                              ReduceOMPReproSum<T, Reduce>,
+                              ReduceOMPPadded<T, Reduce>>::type;
+
+}  // namespace detail
+
+RAJA_DECLARE_REDUCER(Sum, omp_reduce_repro, detail::ReduceOMPRepro)
+RAJA_DECLARE_REDUCER(Min, omp_reduce_repro, detail::ReduceOMPPadded)
+RAJA_DECLARE_REDUCER(Max, omp_reduce_repro, detail::ReduceOMPPadded)
+RAJA_DECLARE_INDEX_REDUCER(MinLoc, omp_reduce_repro, detail::ReduceOMPPadded)
+RAJA_DECLARE_INDEX_REDUCER(MaxLoc, omp_reduce_repro, detail::ReduceOMPPadded)
+RAJA_DECLARE_REDUCER(BitOr, omp_reduce_repro, detail::ReduceOMPPadded)
+RAJA_DECLARE_REDUCER(BitAnd, omp_reduce_repro, detail::ReduceOMPPadded)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_OPENMP guard
@@ -39,6 +39,227 @@ namespace impl
 namespace scan
 {
 
+namespace detail
+{
+namespace openmp
+{
+
+//! Number of contiguous lanes each thread splits its block into
+constexpr int get_scan_lanes() { return 8; }
+
+/*!
+        \brief get a buffer of at least size values that is reused by later
+   scans made from the calling thread
+*/
+template <typename Value>
+inline Value* scan_workspace(size_t size)
+{
+  static thread_local ::std::vector<Value> workspace;
+  if (workspace.size() < size) {
+    workspace.resize(size);
+  }
+  return workspace.data();
+}
+
+/*!
+        \brief out-of-place reduce-then-scan that reads each input value in
+   both passes and writes each output value once
+
+   Each thread splits its block into get_scan_lanes() contiguous lanes and
+   walks them in lock step, so the lanes form independent chains that the
+   compiler can vectorize. Combination order within a lane is unchanged, so
+   f only needs to be associative.
+*/
+template <bool Exclusive,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+inline void scan_out_of_place(Iter begin,
+                              Iter end,
+                              OutIter out,
+                              BinFn f,
+                              ValueT init)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  constexpr int num_lanes = get_scan_lanes();
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return;
+  }
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  // lane totals for every thread, followed by the offset of every thread
+  Value* lane_sums =
+      scan_workspace<Value>(static_cast<size_t>(p0) * (num_lanes + 1));
+  Value* offsets = lane_sums + static_cast<size_t>(p0) * num_lanes;
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+    const DistanceT lane_len = (idx_end - idx_begin) / num_lanes;
+    const DistanceT idx_tail = idx_begin + lane_len * num_lanes;
+
+    Value lane[num_lanes];
+    for (int j = 0; j < num_lanes; ++j) {
+      lane[j] = BinFn::identity();
+    }
+    for (DistanceT k = 0; k < lane_len; ++k) {
+      RAJA_SIMD
+      for (int j = 0; j < num_lanes; ++j) {
+        lane[j] = f(lane[j], begin[idx_begin + j * lane_len + k]);
+      }
+    }
+    // the tail follows the last lane, so it is folded into that lane
+    for (DistanceT i = idx_tail; i < idx_end; ++i) {
+      lane[num_lanes - 1] = f(lane[num_lanes - 1], begin[i]);
+    }
+    for (int j = 0; j < num_lanes; ++j) {
+      lane_sums[pid * num_lanes + j] = lane[j];
+    }
+
+#pragma omp barrier
+#pragma omp single
+    {
+      Value running = init;
+      for (int t = 0; t < p; ++t) {
+        offsets[t] = running;
+        for (int j = 0; j < num_lanes; ++j) {
+          running = f(running, lane_sums[t * num_lanes + j]);
+        }
+      }
+    }
+
+    Value running = offsets[pid];
+    for (int j = 0; j < num_lanes; ++j) {
+      lane[j] = running;
+      running = f(running, lane_sums[pid * num_lanes + j]);
+    }
+    for (DistanceT k = 0; k < lane_len; ++k) {
+      RAJA_SIMD
+      for (int j = 0; j < num_lanes; ++j) {
+        const DistanceT i = idx_begin + j * lane_len + k;
+        const Value x = begin[i];
+        if (Exclusive) {
+          out[i] = lane[j];
+          lane[j] = f(lane[j], x);
+        } else {
+          lane[j] = f(lane[j], x);
+          out[i] = lane[j];
+        }
+      }
+    }
+    for (DistanceT i = idx_tail; i < idx_end; ++i) {
+      const Value x = begin[i];
+      if (Exclusive) {
+        out[i] = lane[num_lanes - 1];
+        lane[num_lanes - 1] = f(lane[num_lanes - 1], x);
+      } else {
+        lane[num_lanes - 1] = f(lane[num_lanes - 1], x);
+        out[i] = lane[num_lanes - 1];
+      }
+    }
+  }
+}
+
+/*!
+        \brief value of the segment reaching the end of a thread's block, and
+   whether that segment starts in the block
+*/
+template <typename Value>
+struct SegmentCarry {
+  Value value;
+  bool has_head;
+};
+
+/*!
+        \brief out-of-place segmented reduce-then-scan, where the scan starts
+   over from init at index 0 and at every index i with is_head(i)
+
+   Threads split the range evenly wherever the segments start, so many tiny
+   segments are scanned as much in parallel as one long one. The first pass
+   reduces the part of the last segment that lies in each block, a pass over
+   the threads turns those into the value carried into each block, and the
+   second pass scans each block starting from its carry.
+*/
+template <bool Exclusive,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn,
+          typename ValueT>
+inline void segmented_scan(Iter begin,
+                           Iter end,
+                           OutIter out,
+                           HeadFn is_head,
+                           BinFn f,
+                           ValueT init)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<OutIter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  if (n <= 0) {
+    return;
+  }
+  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
+  SegmentCarry<Value>* carries =
+      scan_workspace<SegmentCarry<Value>>(static_cast<size_t>(p0));
+#pragma omp parallel num_threads(p0)
+  {
+    const int p = omp_get_num_threads();
+    const int pid = omp_get_thread_num();
+    const DistanceT idx_begin = firstIndex(n, p, pid);
+    const DistanceT idx_end = firstIndex(n, p, pid + 1);
+
+    Value agg = BinFn::identity();
+    bool has_head = false;
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      if (i == 0 || is_head(i)) {
+        agg = init;
+        has_head = true;
+      }
+      agg = f(agg, begin[i]);
+    }
+    carries[pid].value = agg;
+    carries[pid].has_head = has_head;
+
+#pragma omp barrier
+#pragma omp single
+    {
+      Value running = init;
+      for (int t = 0; t < p; ++t) {
+        const Value block = carries[t].value;
+        carries[t].value = running;
+        running = carries[t].has_head ? block : f(running, block);
+      }
+    }
+
+    agg = carries[pid].value;
+    for (DistanceT i = idx_begin; i < idx_end; ++i) {
+      if (i == 0 || is_head(i)) {
+        agg = init;
+      }
+      const Value x = begin[i];
+      if (Exclusive) {
+        out[i] = agg;
+        agg = f(agg, x);
+      } else {
+        agg = f(agg, x);
+        out[i] = agg;
+      }
+    }
+  }
+}
+
+}  // namespace openmp
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -142,15 +363,16 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 inclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
+  detail::openmp::scan_out_of_place<false>(begin, end, out, f,
+                                           BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 /*!
@@ -167,16 +389,71 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 exclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f,
     ValueT v)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
+  detail::openmp::scan_out_of_place<true>(begin, end, out, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive segmented scan given input range, output,
+   segment heads, and function
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+inclusive_segmented(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    HeadFn is_head,
+    BinFn f)
+{
+  detail::openmp::segmented_scan<false>(begin, end, out, is_head, f,
+                                        BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive segmented scan given input range, output,
+   segment heads, function, and initial value of each segment
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename HeadFn,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_openmp_policy<Policy>>
+exclusive_segmented(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    HeadFn is_head,
+    BinFn f,
+    ValueT v)
+{
+  detail::openmp::segmented_scan<true>(begin, end, out, is_head, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 }  // namespace scan
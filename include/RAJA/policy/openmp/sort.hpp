@@ -23,6 +23,8 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <vector>
 
 #include <omp.h>
 
@@ -30,6 +32,10 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/util/sort.hpp"
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/sequential/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
@@ -88,46 +94,175 @@ inline void sort_task(Sorter sorter,
 
 #else
 
+/*!
+        \brief find how many of the first diag merged values come from the
+               first range when stably merging sorted ranges [a, a+a_len)
+               and [b, b+b_len), i.e. the co-rank of diag in the first range
+*/
+template <typename Iter1, typename Iter2, typename Compare>
+inline RAJA::detail::IterDiff<Iter1>
+merge_path_corank(Iter1 a,
+                  RAJA::detail::IterDiff<Iter1> a_len,
+                  Iter2 b,
+                  RAJA::detail::IterDiff<Iter1> b_len,
+                  RAJA::detail::IterDiff<Iter1> diag,
+                  Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter1>;
+
+  diff_type lo = (diag > b_len) ? diag - b_len : 0;
+  diff_type hi = (diag < a_len) ? diag : a_len;
+
+  // find the first i where b[diag-i-1] < a[i]; ties take from the first
+  // range so the merge is stable
+  while (lo < hi) {
+    const diff_type i = lo + (hi - lo) / 2;
+    if (!comp(b[diag - i - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/*!
+        \brief write merged values [diag_begin, diag_end) of the stable merge
+               of sorted ranges [a, a+a_len) and [b, b+b_len) to out
+*/
+template <typename Iter1, typename Iter2, typename OutIter, typename Compare>
+inline void merge_path_segment(Iter1 a,
+                               RAJA::detail::IterDiff<Iter1> a_len,
+                               Iter2 b,
+                               RAJA::detail::IterDiff<Iter1> b_len,
+                               RAJA::detail::IterDiff<Iter1> diag_begin,
+                               RAJA::detail::IterDiff<Iter1> diag_end,
+                               OutIter out,
+                               Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter1>;
+
+  diff_type i = merge_path_corank(a, a_len, b, b_len, diag_begin, comp);
+  diff_type j = diag_begin - i;
+
+  for (diff_type k = diag_begin; k < diag_end; ++k) {
+    if (j >= b_len || (i < a_len && !comp(b[j], a[i]))) {
+      out[k] = std::move(a[i]);
+      ++i;
+    } else {
+      out[k] = std::move(b[j]);
+      ++j;
+    }
+  }
+}
+
+/*!
+        \brief merge adjacent sorted runs from src into dst, the runs being
+               the thread blocks [firstIndex(n, num_threads, t), ...) paired
+               up middle_offset blocks apart. Every thread writes an equal
+               share of dst, using merge path to find where its share starts
+               in each pair of runs it overlaps.
+*/
+template <typename SrcIter, typename DstIter, typename Compare>
+inline void merge_path_round(SrcIter src,
+                             DstIter dst,
+                             RAJA::detail::IterDiff<SrcIter> n,
+                             RAJA::detail::IterDiff<SrcIter> num_threads,
+                             RAJA::detail::IterDiff<SrcIter> thread_id,
+                             RAJA::detail::IterDiff<SrcIter> middle_offset,
+                             Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<SrcIter>;
+
+  const diff_type end_offset = 2*middle_offset;
+
+  const diff_type my_begin = firstIndex(n, num_threads, thread_id);
+  const diff_type my_end   = firstIndex(n, num_threads, thread_id + 1);
+
+  // first pair of runs that overlaps this thread's share of the output
+  diff_type pair = (thread_id / end_offset) * end_offset;
+
+  for (; pair < num_threads; pair += end_offset) {
+
+    const diff_type i_begin  = firstIndex(n, num_threads, pair);
+    const diff_type i_middle = firstIndex(n, num_threads, std::min(pair + middle_offset, num_threads));
+    const diff_type i_end    = firstIndex(n, num_threads, std::min(pair + end_offset,    num_threads));
+
+    if (i_begin >= my_end) {
+      break;
+    }
+
+    const diff_type diag_begin = std::max(my_begin, i_begin) - i_begin;
+    const diff_type diag_end   = std::min(my_end,   i_end)   - i_begin;
+
+    if (diag_begin < diag_end) {
+      merge_path_segment(src + i_begin,  i_middle - i_begin,
+                         src + i_middle, i_end - i_middle,
+                         diag_begin, diag_end,
+                         dst + i_begin, comp);
+    }
+  }
+}
+
 /*!
         \brief sort given range using sorter and comparison function
                by manually assigning work to threads
+
+               Each thread sorts one block, then the blocks are merged in
+               rounds that ping-pong between the range and buf, which holds
+               n move constructed values. Every thread takes part in every
+               round, including the final merge of two halves.
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_parallel_region(Sorter sorter,
                                  Iter begin,
                                  RAJA::detail::IterDiff<Iter> n,
+                                 RAJA::detail::IterVal<Iter>* buf,
                                  Compare comp)
 {
   using RAJA::detail::firstIndex;
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
   const diff_type num_threads = omp_get_num_threads();
 
   const diff_type thread_id = omp_get_thread_num();
 
-  const diff_type i_begin = firstIndex(n, num_threads, thread_id);
   {
-    const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+    const diff_type i_begin = firstIndex(n, num_threads, thread_id);
+    const diff_type i_end   = firstIndex(n, num_threads, thread_id + 1);
 
     // this thread sorts range [i_begin, i_end)
     sorter(begin + i_begin, begin + i_end, comp);
+
+    // and moves it into the buffer
+    for (diff_type i = i_begin; i < i_end; ++i) {
+      new(&buf[i]) value_type(std::move(begin[i]));
+    }
   }
 
-  // hierarchically merge ranges
+  // merge runs in rounds, alternating between buf and the range
+  bool in_buf = true;
   for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
 
-    diff_type end_offset = 2*middle_offset;
-
-    const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
-    const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
-
 #pragma omp barrier
 
-    if (thread_id % end_offset == 0) {
+    if (in_buf) {
+      merge_path_round(buf, begin, n, num_threads, thread_id, middle_offset, comp);
+    } else {
+      merge_path_round(begin, buf, n, num_threads, thread_id, middle_offset, comp);
+    }
+    in_buf = !in_buf;
+  }
 
-      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
-      //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+  if (in_buf) {
+    // an even number of rounds leaves the result in the buffer
+    const diff_type i_begin = firstIndex(n, num_threads, thread_id);
+    const diff_type i_end   = firstIndex(n, num_threads, thread_id + 1);
+#pragma omp barrier
+    for (diff_type i = i_begin; i < i_end; ++i) {
+      begin[i] = std::move(buf[i]);
     }
   }
 }
@@ -177,15 +312,243 @@ void sort(Sorter sorter,
     const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
     RAJA_UNUSED_VAR(requested_num_threads); // avoid warning in hip device code
 
+    using value_type = RAJA::detail::IterVal<Iter>;
+
+    // Manage the lifetime of the buffer and objects constructed in the buffer
+    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+    buf_deleter_type buf_deleter;
+
+    std::unique_ptr<value_type, buf_deleter_type&> merge_buf(
+        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, n * sizeof(value_type) ),
+        buf_deleter);
+
+    // check memory allocation worked
+    if (merge_buf.get() == nullptr) {
+      RAJA_ABORT_OR_THROW( "sort temporary memory allocation failed" );
+    }
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
     {
-      sort_parallel_region(sorter, begin, n, comp);
+      sort_parallel_region(sorter, begin, n, merge_buf.get(), comp);
     }
 
+    // every value in the buffer was constructed in the parallel region
+    buf_deleter.size = n;
+
 #endif
   }
 }
 
+/*!
+        \brief stable radix sort of keys inplace and of vals alongside the
+               keys if vals is not null, by manually assigning work to threads
+
+               Each thread histograms the digit over its block, a single
+               thread turns the histograms into scatter offsets ordered by
+               digit then thread, and each thread scatters its block in order
+               so keys with equal digits keep their relative order. Passes
+               whose digit is the same for every key are skipped.
+*/
+template <typename Compare, typename Key, typename Val>
+inline void radix_sort(Key* keys, Val* vals, size_t len)
+{
+  using RAJA::detail::firstIndex;
+  using RAJA::detail::radix_bits;
+  using RAJA::detail::radix_digit;
+  using RAJA::detail::radix_num_buckets;
+  using bits_type = typename RAJA::detail::radix_key<Key>::bits_type;
+
+  constexpr size_t num_passes = sizeof(bits_type);
+  constexpr size_t min_iterates_per_thread = RAJA::detail::radix_sort_cutoff;
+
+  if (len < 2) {
+    return;
+  }
+
+  const size_t max_threads = omp_get_max_threads();
+
+  const size_t requested_num_threads = std::min((len+min_iterates_per_thread-1)/min_iterates_per_thread, max_threads);
+
+  const bool has_vals = (vals != nullptr);
+
+  std::unique_ptr<Key, FreeAligned> key_buf(RAJA::detail::radix_allocate<Key>(len));
+  std::unique_ptr<Val, FreeAligned> val_buf(
+      has_vals ? RAJA::detail::radix_allocate<Val>(len) : nullptr);
+
+  // per thread histograms of every digit of the input
+  std::vector<size_t> input_counts(requested_num_threads * num_passes * radix_num_buckets, 0);
+  // per thread histograms of the current digit, then scatter offsets
+  std::vector<size_t> offsets(requested_num_threads * radix_num_buckets);
+  bool skip_pass[num_passes];
+
+#pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
+  {
+    const size_t num_threads = omp_get_num_threads();
+    const size_t thread_id = omp_get_thread_num();
+
+    const size_t i_begin = firstIndex(len, num_threads, thread_id);
+    const size_t i_end   = firstIndex(len, num_threads, thread_id + 1);
+
+    size_t* my_input_counts = &input_counts[thread_id * num_passes * radix_num_buckets];
+    size_t* my_offsets = &offsets[thread_id * radix_num_buckets];
+
+    for (size_t i = i_begin; i < i_end; ++i) {
+      const bits_type u = radix_bits<Compare>(keys[i]);
+      for (size_t pass = 0; pass < num_passes; ++pass) {
+        ++my_input_counts[pass * radix_num_buckets + radix_digit(u, pass)];
+      }
+    }
+
+#pragma omp barrier
+#pragma omp single
+    {
+      const bits_type u = radix_bits<Compare>(keys[0]);
+      for (size_t pass = 0; pass < num_passes; ++pass) {
+        const size_t digit = radix_digit(u, pass);
+        size_t count = 0;
+        for (size_t t = 0; t < num_threads; ++t) {
+          count += input_counts[(t * num_passes + pass) * radix_num_buckets + digit];
+        }
+        skip_pass[pass] = (count == len);
+      }
+    }
+
+    Key* src_keys = keys;
+    Val* src_vals = vals;
+    Key* dst_keys = key_buf.get();
+    Val* dst_vals = val_buf.get();
+
+    bool first_pass = true;
+    for (size_t pass = 0; pass < num_passes; ++pass) {
+
+      if (skip_pass[pass]) {
+        continue;
+      }
+
+      if (first_pass) {
+        // the input histogram of this block is still valid
+        std::copy(my_input_counts + pass * radix_num_buckets,
+                  my_input_counts + (pass + 1) * radix_num_buckets,
+                  my_offsets);
+        first_pass = false;
+      } else {
+        std::fill(my_offsets, my_offsets + radix_num_buckets, size_t(0));
+        for (size_t i = i_begin; i < i_end; ++i) {
+          ++my_offsets[radix_digit(radix_bits<Compare>(src_keys[i]), pass)];
+        }
+      }
+
+#pragma omp barrier
+#pragma omp single
+      {
+        size_t sum = 0;
+        for (size_t b = 0; b < radix_num_buckets; ++b) {
+          for (size_t t = 0; t < num_threads; ++t) {
+            const size_t count = offsets[t * radix_num_buckets + b];
+            offsets[t * radix_num_buckets + b] = sum;
+            sum += count;
+          }
+        }
+      }
+
+      for (size_t i = i_begin; i < i_end; ++i) {
+        const size_t dst = my_offsets[radix_digit(radix_bits<Compare>(src_keys[i]), pass)]++;
+        dst_keys[dst] = src_keys[i];
+        if (has_vals) {
+          dst_vals[dst] = src_vals[i];
+        }
+      }
+
+#pragma omp barrier
+
+      std::swap(src_keys, dst_keys);
+      std::swap(src_vals, dst_vals);
+    }
+
+    if (src_keys != keys) {
+      std::copy(src_keys + i_begin, src_keys + i_end, keys + i_begin);
+      if (has_vals) {
+        std::copy(src_vals + i_begin, src_vals + i_end, vals + i_begin);
+      }
+    }
+  }
+}
+
+/*!
+        \brief sort given range using sorter and comparison function
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if_t<void,
+                      concepts::negate<RAJA::detail::is_radix_sortable<Iter, Compare>>>
+radix_or_sort(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  sort(sorter, begin, end, comp);
+}
+
+/*!
+        \brief sort given range of arithmetic keys using radix sort,
+               falls back to sorter for short ranges
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+concepts::enable_if_t<void,
+                      RAJA::detail::is_radix_sortable<Iter, Compare>>
+radix_or_sort(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  const size_t len = static_cast<size_t>(end - begin);
+  if (len < RAJA::detail::radix_sort_cutoff) {
+    sorter(begin, end, comp);
+  } else {
+    radix_sort<Compare>(begin, static_cast<RAJA::detail::radix_no_value*>(nullptr), len);
+  }
+}
+
+/*!
+        \brief sort given range of pairs using sorter and comparison
+               function on keys
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if_t<void,
+                      concepts::negate<RAJA::detail::is_radix_sortable_pairs<KeyIter, ValIter, Compare>>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  sort(sorter, begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
+/*!
+        \brief sort given range of pairs with arithmetic keys using radix
+               sort, falls back to sorter for short ranges
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+inline
+concepts::enable_if_t<void,
+                      RAJA::detail::is_radix_sortable_pairs<KeyIter, ValIter, Compare>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  const size_t len = static_cast<size_t>(keys_end - keys_begin);
+  if (len < RAJA::detail::radix_sort_cutoff) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    radix_sort<Compare>(keys_begin, vals_begin, len);
+  }
+}
+
 } // namespace openmp
 
 } // namespace detail
@@ -203,7 +566,7 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, comp);
+  detail::openmp::radix_or_sort(detail::UnstableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -221,7 +584,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  detail::openmp::radix_or_sort(detail::StableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -240,10 +603,8 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::radix_or_sort_pairs(detail::UnstableSorter{},
+                                      keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -262,10 +623,8 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::openmp::radix_or_sort_pairs(detail::StableSorter{},
+                                      keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
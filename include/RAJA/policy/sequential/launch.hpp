@@ -18,6 +18,7 @@
 #ifndef RAJA_pattern_launch_sequential_HPP
 #define RAJA_pattern_launch_sequential_HPP
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/pattern/launch/launch_core.hpp"
 #include "RAJA/policy/sequential/policy.hpp"
 
@@ -46,12 +47,12 @@ struct LaunchExecute<RAJA::seq_launch_t> {
 
     LaunchContext ctx;
 
-    char *kernel_local_mem = new char[params.shared_mem_size];
-    ctx.shared_mem_ptr = kernel_local_mem;
+    // reuse this thread's scratch buffer across launches
+    ThreadScratch scratch(params.shared_mem_size);
+    ctx.shared_mem_ptr = scratch.get();
 
     body(ctx);
 
-    delete[] kernel_local_mem;
     ctx.shared_mem_ptr = nullptr;
 
     return resources::EventProxy<resources::Resource>(res);
@@ -26,6 +26,30 @@ namespace detail {
     *red.target = OP{}(red.val, *red.target);
   }
 
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  init(ArrayReducer<OP, T>& red) {
+    red.bins.assign(red.size, OP::identity());
+    red.val = red.bins.data();
+  }
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  combine(ArrayReducer<OP, T>& out, const ArrayReducer<OP, T>& in) {
+    for (size_t i = 0; i < in.size; ++i) {
+      out.val[i] = OP{}(out.val[i], in.val[i]);
+    }
+  }
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< std::is_same< EXEC_POL, RAJA::seq_exec> >
+  resolve(ArrayReducer<OP, T>& red) {
+    for (size_t i = 0; i < red.size; ++i) {
+      red.target[i] = OP{}(red.val[i], red.target[i]);
+    }
+  }
+
 } //  namespace detail
 } //  namespace expt
 } //  namespace RAJA
@@ -72,6 +72,78 @@ struct StableSorter
   }
 };
 
+/*!
+    \brief sort given range using sorter and comparison function
+*/
+template <typename Sorter, typename Iter, typename Compare>
+concepts::enable_if_t<void,
+                      concepts::negate<RAJA::detail::is_radix_sortable<Iter, Compare>>>
+radix_or_sort(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  sorter(begin, end, comp);
+}
+
+/*!
+    \brief sort given range of arithmetic keys using radix sort,
+    falls back to sorter for short ranges
+*/
+template <typename Sorter, typename Iter, typename Compare>
+concepts::enable_if_t<void,
+                      RAJA::detail::is_radix_sortable<Iter, Compare>>
+radix_or_sort(Sorter sorter, Iter begin, Iter end, Compare comp)
+{
+  size_t len = static_cast<size_t>(end - begin);
+  if (len < RAJA::detail::radix_sort_cutoff) {
+    sorter(begin, end, comp);
+  } else {
+    RAJA::detail::radix_sort<Compare>(
+        begin, static_cast<RAJA::detail::radix_no_value*>(nullptr), len);
+  }
+}
+
+/*!
+    \brief sort given range of pairs using sorter and comparison function
+    on keys
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<void,
+                      concepts::negate<RAJA::detail::is_radix_sortable_pairs<KeyIter, ValIter, Compare>>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  auto begin = RAJA::zip(keys_begin, vals_begin);
+  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+}
+
+/*!
+    \brief sort given range of pairs with arithmetic keys using radix sort,
+    falls back to sorter for short ranges
+*/
+template <typename Sorter, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<void,
+                      RAJA::detail::is_radix_sortable_pairs<KeyIter, ValIter, Compare>>
+radix_or_sort_pairs(Sorter sorter,
+                    KeyIter keys_begin,
+                    KeyIter keys_end,
+                    ValIter vals_begin,
+                    Compare comp)
+{
+  size_t len = static_cast<size_t>(keys_end - keys_begin);
+  if (len < RAJA::detail::radix_sort_cutoff) {
+    auto begin = RAJA::zip(keys_begin, vals_begin);
+    auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    sorter(begin, end, RAJA::compare_first<zip_ref>(comp));
+  } else {
+    RAJA::detail::radix_sort<Compare>(keys_begin, vals_begin, len);
+  }
+}
+
 } // namespace detail
 
 /*!
@@ -87,7 +159,7 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::UnstableSorter{}(begin, end, comp);
+  detail::radix_or_sort(detail::UnstableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -105,7 +177,7 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::StableSorter{}(begin, end, comp);
+  detail::radix_or_sort(detail::StableSorter{}, begin, end, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -124,10 +196,8 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::UnstableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::radix_or_sort_pairs(detail::UnstableSorter{},
+                              keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -146,10 +216,8 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  detail::radix_or_sort_pairs(detail::StableSorter{},
+                              keys_begin, keys_end, vals_begin, comp);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -0,0 +1,40 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA headers for thread pool execution.
+ *
+ *          These methods use a persistent pool of std::threads and work on
+ *          any platform with C++ threading support.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+#ifndef RAJA_thread_pool_HPP
+#define RAJA_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include "RAJA/policy/thread_pool/ThreadPool.hpp"
+#include "RAJA/policy/thread_pool/forall.hpp"
+#include "RAJA/policy/thread_pool/policy.hpp"
+#include "RAJA/policy/thread_pool/reduce.hpp"
+#include "RAJA/policy/thread_pool/scan.hpp"
+#include "RAJA/policy/thread_pool/sort.hpp"
+#include "RAJA/policy/thread_pool/WorkGroup.hpp"
+
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,432 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the persistent thread pool that backs the
+ *          RAJA thread_pool execution policies.
+ *
+ *          The pool owns a fixed set of std::threads that live for the
+ *          duration of the program. A dispatch publishes a team function
+ *          and bumps an epoch counter; workers spin on the epoch for a short
+ *          time before blocking, so back-to-back loops do not pay for a
+ *          thread wake-up. Loop iterations are split into one block per
+ *          thread and threads that finish their own block steal chunks
+ *          from the blocks of other threads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_thread_pool_ThreadPool_HPP
+#define RAJA_thread_pool_ThreadPool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+
+namespace thread_pool
+{
+
+namespace detail
+{
+
+//! Number of polls a waiting thread makes before it blocks
+constexpr int spin_count = 1 << 14;
+
+/*!
+ * \brief Hint to the processor that the calling thread is spin waiting.
+ */
+inline void cpu_relax()
+{
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+  asm volatile("yield" ::: "memory");
+#else
+  std::this_thread::yield();
+#endif
+}
+
+/*!
+ * \brief Pause a spin-waiting thread, periodically yielding so that waiting
+ *        threads do not starve running ones when cores are oversubscribed.
+ */
+inline void spin_pause(int& spins)
+{
+  if ((++spins & 63) == 0) {
+    std::this_thread::yield();
+  } else {
+    cpu_relax();
+  }
+}
+
+/*!
+ * \brief Id of the calling thread in the team it is running in, or -1 if
+ *        the calling thread is not running a team function.
+ */
+inline int& this_thread_team_id()
+{
+  static thread_local int id = -1;
+  return id;
+}
+
+/*!
+ * \brief Spinning sense-reversing barrier for the members of a team.
+ */
+class Barrier
+{
+public:
+  void reset(int size)
+  {
+    m_size = size;
+    m_count.store(0, std::memory_order_relaxed);
+  }
+
+  void wait()
+  {
+    const unsigned phase = m_phase.load(std::memory_order_acquire);
+    if (m_count.fetch_add(1, std::memory_order_acq_rel) == m_size - 1) {
+      m_count.store(0, std::memory_order_relaxed);
+      m_phase.store(phase + 1, std::memory_order_release);
+    } else {
+      int spins = 0;
+      while (m_phase.load(std::memory_order_acquire) == phase) {
+        spin_pause(spins);
+      }
+    }
+  }
+
+private:
+  alignas(cache_line_size) std::atomic<int> m_count{0};
+  alignas(cache_line_size) std::atomic<unsigned> m_phase{0};
+  int m_size = 1;
+};
+
+/*!
+ * \brief Block of loop iterations owned by one thread. The owner and
+ *        thieves both claim chunks from the front of the block.
+ */
+struct alignas(cache_line_size) RangeBlock {
+  std::atomic<std::ptrdiff_t> next{0};
+  std::ptrdiff_t end = 0;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Description of the calling thread's place in a running team.
+ *
+ *        A Team is passed to every team function. When a team function runs
+ *        inline (nested parallelism, or the pool is busy) the team has a
+ *        single member and sync() is a no-op.
+ */
+class Team
+{
+public:
+  Team(int thread_id,
+       int num_threads,
+       detail::Barrier* barrier,
+       detail::RangeBlock* ranges,
+       std::ptrdiff_t len,
+       std::ptrdiff_t grain)
+      : m_thread_id(thread_id),
+        m_num_threads(num_threads),
+        m_barrier(barrier),
+        m_ranges(ranges),
+        m_len(len),
+        m_grain(grain)
+  {
+  }
+
+  int thread_id() const { return m_thread_id; }
+
+  int num_threads() const { return m_num_threads; }
+
+  //! Wait until every member of the team has reached this point
+  void sync() const
+  {
+    if (m_barrier) {
+      m_barrier->wait();
+    }
+  }
+
+  /*!
+   * \brief Call func(begin, end) for chunks of the range given to
+   *        ThreadPool::run_range until no iterations are left. Chunks are
+   *        taken from this thread's own block first and then stolen from
+   *        the blocks of the other team members.
+   */
+  template <typename Func>
+  void for_each_chunk(Func&& func) const
+  {
+    if (!m_ranges) {
+      if (m_len > 0) {
+        func(std::ptrdiff_t(0), m_len);
+      }
+      return;
+    }
+    for (int k = 0; k < m_num_threads; ++k) {
+      detail::RangeBlock& block = m_ranges[(m_thread_id + k) % m_num_threads];
+      for (;;) {
+        const std::ptrdiff_t b =
+            block.next.fetch_add(m_grain, std::memory_order_relaxed);
+        if (b >= block.end) {
+          break;
+        }
+        func(b, std::min(b + m_grain, block.end));
+      }
+    }
+  }
+
+private:
+  int m_thread_id;
+  int m_num_threads;
+  detail::Barrier* m_barrier;
+  detail::RangeBlock* m_ranges;
+  std::ptrdiff_t m_len;
+  std::ptrdiff_t m_grain;
+};
+
+/*!
+ * \brief Persistent pool of worker threads.
+ *
+ *        The calling thread always takes part in a dispatch as thread 0,
+ *        so a pool of N threads creates N-1 workers. Only one team runs at
+ *        a time; a dispatch made while the pool is busy, or from inside a
+ *        team function, runs inline on the calling thread so nested
+ *        parallelism never oversubscribes the cores.
+ */
+class ThreadPool
+{
+public:
+  //! Number of chunks each thread's block is split into for stealing
+  static constexpr std::ptrdiff_t chunks_per_thread = 8;
+
+  /*!
+   * \brief Get the process-wide pool. The pool size is read from the
+   *        environment variable RAJA_THREAD_POOL_NUM_THREADS and defaults
+   *        to the number of hardware threads.
+   */
+  static ThreadPool& get()
+  {
+    static ThreadPool pool(default_num_threads());
+    return pool;
+  }
+
+  explicit ThreadPool(int num_threads)
+  {
+    // operator new[] does not honor over-alignment before C++17, so carve
+    // cache line aligned blocks out of a padded buffer
+    const std::size_t nblocks =
+        static_cast<std::size_t>(std::max(num_threads, 1));
+    std::size_t space = (nblocks + 1) * sizeof(detail::RangeBlock);
+    m_range_storage.reset(new char[space]);
+    void* ptr = m_range_storage.get();
+    ptr = std::align(alignof(detail::RangeBlock),
+                     nblocks * sizeof(detail::RangeBlock), ptr, space);
+    m_ranges = static_cast<detail::RangeBlock*>(ptr);
+    for (std::size_t i = 0; i < nblocks; ++i) {
+      new (&m_ranges[i]) detail::RangeBlock;
+    }
+
+    for (int tid = 1; tid < num_threads; ++tid) {
+      m_workers.emplace_back([this, tid]() { worker_loop(tid); });
+    }
+  }
+
+  ThreadPool(ThreadPool const&) = delete;
+  ThreadPool& operator=(ThreadPool const&) = delete;
+
+  ~ThreadPool()
+  {
+    m_stop.store(true, std::memory_order_relaxed);
+    m_epoch.fetch_add(1);
+    {
+      std::lock_guard<std::mutex> lock(m_sleep_mutex);
+      m_wake.notify_all();
+    }
+    for (std::thread& worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  //! Number of threads in a full team, including the calling thread
+  int num_threads() const { return static_cast<int>(m_workers.size()) + 1; }
+
+  /*!
+   * \brief Run body(team) on every member of a team and wait for all of
+   *        them to return. body may be called concurrently.
+   */
+  template <typename TeamBody>
+  void run(TeamBody&& body)
+  {
+    run_range(0, std::forward<TeamBody>(body));
+  }
+
+  /*!
+   * \brief Run body(team) on every member of a team and share the
+   *        iterations [0, len) between them through Team::for_each_chunk.
+   */
+  template <typename TeamBody>
+  void run_range(std::ptrdiff_t len, TeamBody&& body)
+  {
+    using body_type = typename std::remove_reference<TeamBody>::type;
+
+    std::unique_lock<std::mutex> dispatch(m_dispatch_mutex, std::try_to_lock);
+    if (!dispatch.owns_lock() || m_workers.empty() ||
+        detail::this_thread_team_id() >= 0) {
+      body(Team(0, 1, nullptr, nullptr, len, len));
+      return;
+    }
+
+    const int nthreads = num_threads();
+    m_grain = std::max(std::ptrdiff_t(1),
+                       len / (chunks_per_thread * nthreads));
+    m_len = len;
+    for (int tid = 0; tid < nthreads; ++tid) {
+      m_ranges[tid].next.store((len * tid) / nthreads,
+                               std::memory_order_relaxed);
+      m_ranges[tid].end = (len * (tid + 1)) / nthreads;
+    }
+    m_barrier.reset(nthreads);
+    m_data = static_cast<void*>(std::addressof(body));
+    m_func = [](void* data, Team const& team) {
+      (*static_cast<body_type*>(data))(team);
+    };
+    m_pending.store(nthreads - 1, std::memory_order_relaxed);
+
+    // seq_cst pairs with the sleeper count in wait_for_work
+    m_epoch.fetch_add(1);
+    if (m_sleeping.load() > 0) {
+      std::lock_guard<std::mutex> lock(m_sleep_mutex);
+      m_wake.notify_all();
+    }
+
+    execute(0);
+
+    int spins = 0;
+    while (m_pending.load(std::memory_order_acquire) != 0) {
+      detail::spin_pause(spins);
+    }
+  }
+
+private:
+  using team_function = void (*)(void*, Team const&);
+
+  static int default_num_threads()
+  {
+    if (const char* env = std::getenv("RAJA_THREAD_POOL_NUM_THREADS")) {
+      const int n = std::atoi(env);
+      if (n > 0) {
+        return n;
+      }
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  void execute(int tid)
+  {
+    detail::this_thread_team_id() = tid;
+    m_func(m_data,
+           Team(tid, num_threads(), &m_barrier, m_ranges, m_len, m_grain));
+    detail::this_thread_team_id() = -1;
+  }
+
+  unsigned long long wait_for_work(unsigned long long seen)
+  {
+    for (int spins = 0; spins < detail::spin_count;) {
+      const unsigned long long epoch =
+          m_epoch.load(std::memory_order_acquire);
+      if (epoch != seen) {
+        return epoch;
+      }
+      detail::spin_pause(spins);
+    }
+
+    m_sleeping.fetch_add(1);
+    unsigned long long epoch = seen;
+    {
+      std::unique_lock<std::mutex> lock(m_sleep_mutex);
+      m_wake.wait(lock, [&]() {
+        epoch = m_epoch.load();
+        return epoch != seen;
+      });
+    }
+    m_sleeping.fetch_sub(1);
+    return epoch;
+  }
+
+  void worker_loop(int tid)
+  {
+    unsigned long long seen = 0;
+    for (;;) {
+      seen = wait_for_work(seen);
+      if (m_stop.load(std::memory_order_relaxed)) {
+        return;
+      }
+      execute(tid);
+      m_pending.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  std::vector<std::thread> m_workers;
+  std::unique_ptr<char[]> m_range_storage;
+  detail::RangeBlock* m_ranges = nullptr;
+  detail::Barrier m_barrier;
+
+  std::mutex m_dispatch_mutex;
+  team_function m_func = nullptr;
+  void* m_data = nullptr;
+  std::ptrdiff_t m_len = 0;
+  std::ptrdiff_t m_grain = 1;
+
+  alignas(cache_line_size) std::atomic<unsigned long long> m_epoch{0};
+  alignas(cache_line_size) std::atomic<int> m_pending{0};
+  alignas(cache_line_size) std::atomic<int> m_sleeping{0};
+  std::atomic<bool> m_stop{false};
+
+  std::mutex m_sleep_mutex;
+  std::condition_variable m_wake;
+};
+
+//! Number of threads in a full thread_pool team
+inline int get_num_threads() { return ThreadPool::get().num_threads(); }
+
+//! Id of the calling thread in its thread_pool team, 0 outside of a team
+inline int get_thread_num()
+{
+  return std::max(detail::this_thread_team_id(), 0);
+}
+
+}  // namespace thread_pool
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
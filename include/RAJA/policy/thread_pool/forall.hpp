@@ -0,0 +1,147 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA index set and segment iteration
+ *          template methods for thread pool execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_forall_thread_pool_HPP
+#define RAJA_forall_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/internal/fault_tolerance.hpp"
+
+#include "RAJA/index/IndexSet.hpp"
+#include "RAJA/index/ListSegment.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/policy/thread_pool/ThreadPool.hpp"
+#include "RAJA/policy/thread_pool/policy.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+
+#include "RAJA/pattern/params/forall.hpp"
+
+namespace RAJA
+{
+
+namespace policy
+{
+namespace thread_pool
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// The following function templates iterate over segments using the
+// persistent thread pool. Each pool thread runs a private copy of the
+// loop body over the chunks of iterations it claims.
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::Host>,
+    expt::type_traits::is_ForallParamPack<ForallParam>,
+    expt::type_traits::is_ForallParamPack_empty<ForallParam>>
+forall_impl(resources::Host host_res,
+            const thread_pool_exec&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam)
+{
+  RAJA_EXTRACT_BED_IT(iter);
+
+  RAJA::thread_pool::ThreadPool::get().run_range(
+      static_cast<std::ptrdiff_t>(distance_it),
+      [&](RAJA::thread_pool::Team const& team) {
+        using RAJA::internal::thread_privatize;
+        auto body = thread_privatize(loop_body);
+        team.for_each_chunk([&](std::ptrdiff_t b, std::ptrdiff_t e) {
+          using diff_type = decltype(distance_it);
+          for (diff_type i = static_cast<diff_type>(b);
+               i < static_cast<diff_type>(e);
+               ++i) {
+            body.get_priv()(begin_it[i]);
+          }
+        });
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename Iterable, typename Func, typename ForallParam>
+RAJA_INLINE concepts::enable_if_t<
+    resources::EventProxy<resources::Host>,
+    expt::type_traits::is_ForallParamPack<ForallParam>,
+    concepts::negate<expt::type_traits::is_ForallParamPack_empty<ForallParam>>>
+forall_impl(resources::Host host_res,
+            const thread_pool_exec&,
+            Iterable&& iter,
+            Func&& loop_body,
+            ForallParam f_params)
+{
+  expt::ParamMultiplexer::init<thread_pool_exec>(f_params);
+
+  RAJA_EXTRACT_BED_IT(iter);
+
+  auto& pool = RAJA::thread_pool::ThreadPool::get();
+
+  // each thread reduces into a local copy and publishes it once at the end
+  std::vector<ForallParam> thread_params(pool.num_threads(), f_params);
+
+  pool.run_range(
+      static_cast<std::ptrdiff_t>(distance_it),
+      [&](RAJA::thread_pool::Team const& team) {
+        using RAJA::internal::thread_privatize;
+        auto body = thread_privatize(loop_body);
+        ForallParam local_params = f_params;
+        team.for_each_chunk([&](std::ptrdiff_t b, std::ptrdiff_t e) {
+          using diff_type = decltype(distance_it);
+          for (diff_type i = static_cast<diff_type>(b);
+               i < static_cast<diff_type>(e);
+               ++i) {
+            expt::invoke_body(local_params, body.get_priv(), begin_it[i]);
+          }
+        });
+        thread_params[team.thread_id()] = local_params;
+      });
+
+  for (ForallParam& params : thread_params) {
+    expt::ParamMultiplexer::combine<thread_pool_exec>(f_params, params);
+  }
+
+  expt::ParamMultiplexer::resolve<thread_pool_exec>(f_params);
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace thread_pool
+
+}  // namespace policy
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,65 @@
+#ifndef NEW_REDUCE_THREAD_POOL_REDUCE_HPP
+#define NEW_REDUCE_THREAD_POOL_REDUCE_HPP
+
+#include "RAJA/pattern/params/reducer.hpp"
+
+namespace RAJA {
+namespace expt {
+namespace detail {
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< RAJA::type_traits::is_thread_pool_policy<EXEC_POL> >
+  init(Reducer<OP, T>& red) {
+    red.val = OP::identity();
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< RAJA::type_traits::is_thread_pool_policy<EXEC_POL> >
+  combine(Reducer<OP, T>& out, const Reducer<OP, T>& in) {
+    out.val = OP{}(out.val, in.val);
+  }
+
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< RAJA::type_traits::is_thread_pool_policy<EXEC_POL> >
+  resolve(Reducer<OP, T>& red) {
+    *red.target = OP{}(red.val, *red.target);
+  }
+
+  // Init
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< RAJA::type_traits::is_thread_pool_policy<EXEC_POL> >
+  init(ArrayReducer<OP, T>& red) {
+    red.bins.assign(red.size, OP::identity());
+    red.val = red.bins.data();
+  }
+
+  // Combine
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< RAJA::type_traits::is_thread_pool_policy<EXEC_POL> >
+  combine(ArrayReducer<OP, T>& out, const ArrayReducer<OP, T>& in) {
+    for (size_t i = 0; i < in.size; ++i) {
+      out.val[i] = OP{}(out.val[i], in.val[i]);
+    }
+  }
+
+  // Resolve
+  template<typename EXEC_POL, typename OP, typename T>
+  camp::concepts::enable_if< RAJA::type_traits::is_thread_pool_policy<EXEC_POL> >
+  resolve(ArrayReducer<OP, T>& red) {
+    for (size_t i = 0; i < red.size; ++i) {
+      red.target[i] = OP{}(red.val[i], red.target[i]);
+    }
+  }
+
+#endif
+
+} //  namespace detail
+} //  namespace expt
+} //  namespace RAJA
+
+#endif //  NEW_REDUCE_THREAD_POOL_REDUCE_HPP
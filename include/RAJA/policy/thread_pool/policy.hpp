@@ -0,0 +1,85 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA thread pool policy definitions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef policy_thread_pool_HPP
+#define policy_thread_pool_HPP
+
+#include "RAJA/policy/PolicyBase.hpp"
+
+namespace RAJA
+{
+namespace policy
+{
+namespace thread_pool
+{
+
+//
+//////////////////////////////////////////////////////////////////////
+//
+// Execution policies
+//
+//////////////////////////////////////////////////////////////////////
+//
+
+///
+/// Segment execution policy. Iterations are split into one block per pool
+/// thread and idle threads steal chunks from the blocks of busy threads.
+///
+struct thread_pool_exec
+    : make_policy_pattern_launch_platform_t<Policy::thread_pool,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+/// Index set segment iteration policies
+///
+using thread_pool_segit = thread_pool_exec;
+
+///
+/// WorkGroup execution policies
+///
+struct thread_pool_work
+    : make_policy_pattern_launch_platform_t<Policy::thread_pool,
+                                            Pattern::workgroup_exec,
+                                            Launch::sync,
+                                            Platform::host> {
+};
+
+///
+///////////////////////////////////////////////////////////////////////
+///
+/// Reduction execution policies
+///
+///////////////////////////////////////////////////////////////////////
+///
+struct thread_pool_reduce
+    : make_policy_pattern_t<Policy::thread_pool, Pattern::reduce> {
+};
+
+}  // namespace thread_pool
+}  // namespace policy
+
+using policy::thread_pool::thread_pool_exec;
+using policy::thread_pool::thread_pool_reduce;
+using policy::thread_pool::thread_pool_segit;
+using policy::thread_pool::thread_pool_work;
+
+}  // namespace RAJA
+
+#endif
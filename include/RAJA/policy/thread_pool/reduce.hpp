@@ -0,0 +1,78 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing RAJA reduction templates for
+ *          thread pool execution.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_thread_pool_reduce_HPP
+#define RAJA_thread_pool_reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <mutex>
+
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/reduce.hpp"
+
+#include "RAJA/policy/thread_pool/policy.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! Lock serializing the combination of thread-private reducer copies
+inline std::mutex& thread_pool_reduce_mutex()
+{
+  static std::mutex mtx;
+  return mtx;
+}
+
+template <typename T, typename Reduce>
+class ReduceThreadPool
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceThreadPool<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceThreadPool>;
+
+public:
+  using Base::Base;
+  //! prohibit compiler-generated default ctor
+  ReduceThreadPool() = delete;
+
+  ~ReduceThreadPool()
+  {
+    if (Base::parent) {
+      std::lock_guard<std::mutex> lock(thread_pool_reduce_mutex());
+      Reduce()(Base::parent->local(), Base::my_data);
+      Base::my_data = Base::identity;
+    }
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(thread_pool_reduce, detail::ReduceThreadPool)
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
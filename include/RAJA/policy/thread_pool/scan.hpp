@@ -0,0 +1,204 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA scan declarations for thread pool
+*          execution.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_scan_thread_pool_HPP
+#define RAJA_scan_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "RAJA/policy/thread_pool/ThreadPool.hpp"
+#include "RAJA/policy/thread_pool/policy.hpp"
+#include "RAJA/policy/sequential/scan.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace scan
+{
+
+/*!
+        \brief explicit inclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<Policy>>
+inclusive_inplace(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  auto& pool = RAJA::thread_pool::ThreadPool::get();
+  const int p0 = std::min(n, static_cast<DistanceT>(pool.num_threads()));
+  if (p0 <= 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+  ::std::vector<Value> sums(p0, Value());
+  pool.run([&](RAJA::thread_pool::Team const& team) {
+    const int p = std::min(p0, team.num_threads());
+    const int pid = team.thread_id();
+    const DistanceT idx_begin = pid < p ? firstIndex(n, p, pid) : n;
+    const DistanceT idx_end = pid < p ? firstIndex(n, p, pid + 1) : n;
+    if (idx_begin != idx_end) {
+      inclusive_inplace(host_res, ::RAJA::seq_exec{},
+                        begin + idx_begin, begin + idx_end, f);
+      sums[pid] = begin[idx_end - 1];
+    }
+    team.sync();
+    if (pid == 0) {
+      exclusive_inplace(host_res, ::RAJA::seq_exec{},
+                        sums.data(), sums.data() + p, f, BinFn::identity());
+    }
+    team.sync();
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      begin[i] = f(begin[i], sums[pid]);
+    }
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit exclusive inplace scan given range, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename BinFn, typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<Policy>>
+exclusive_inplace(
+    resources::Host host_res,
+    const Policy&,
+    Iter begin,
+    Iter end,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  using RAJA::detail::firstIndex;
+  using Value = typename ::std::iterator_traits<Iter>::value_type;
+  const auto n = distance(begin, end);
+  using DistanceT = typename std::remove_const<decltype(n)>::type;
+  auto& pool = RAJA::thread_pool::ThreadPool::get();
+  const int p0 = std::min(n, static_cast<DistanceT>(pool.num_threads()));
+  if (p0 <= 0) {
+    return resources::EventProxy<resources::Host>(host_res);
+  }
+  ::std::vector<Value> sums(p0, v);
+  pool.run([&](RAJA::thread_pool::Team const& team) {
+    const int p = std::min(p0, team.num_threads());
+    const int pid = team.thread_id();
+    const DistanceT idx_begin = pid < p ? firstIndex(n, p, pid) : n;
+    const DistanceT idx_end = pid < p ? firstIndex(n, p, pid + 1) : n;
+    const Value init = ((pid == 0 || idx_begin == idx_end)
+                            ? Value(v)
+                            : *(begin + idx_begin - 1));
+    team.sync();
+    if (idx_begin != idx_end) {
+      exclusive_inplace(host_res, seq_exec{},
+                        begin + idx_begin, begin + idx_end, f, init);
+      sums[pid] = begin[idx_end - 1];
+    }
+    team.sync();
+    if (pid == 0) {
+      exclusive_inplace(host_res, seq_exec{},
+                        sums.data(), sums.data() + p, f, BinFn::identity());
+    }
+    team.sync();
+    for (auto i = idx_begin; i < idx_end; ++i) {
+      begin[i] = f(begin[i], sums[pid]);
+    }
+  });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief explicit inclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy, typename Iter, typename OutIter, typename BinFn>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<Policy>>
+inclusive(
+    resources::Host host_res,
+    const Policy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f)
+{
+  using std::distance;
+  ::std::copy(begin, end, out);
+  return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
+}
+
+/*!
+        \brief explicit exclusive scan given input range, output, function, and
+   initial value
+*/
+template <typename Policy,
+          typename Iter,
+          typename OutIter,
+          typename BinFn,
+          typename ValueT>
+RAJA_INLINE
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<Policy>>
+exclusive(
+    resources::Host host_res,
+    const Policy& exec,
+    Iter begin,
+    Iter end,
+    OutIter out,
+    BinFn f,
+    ValueT v)
+{
+  using std::distance;
+  ::std::copy(begin, end, out);
+  return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
+}
+
+}  // namespace scan
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
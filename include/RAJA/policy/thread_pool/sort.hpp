@@ -0,0 +1,228 @@
+/*!
+******************************************************************************
+*
+* \file
+*
+* \brief   Header file providing RAJA sort declarations for thread pool
+*          execution.
+*
+******************************************************************************
+*/
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_sort_thread_pool_HPP
+#define RAJA_sort_thread_pool_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_THREAD_POOL)
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/util/concepts.hpp"
+
+#include "RAJA/policy/thread_pool/ThreadPool.hpp"
+#include "RAJA/policy/thread_pool/policy.hpp"
+#include "RAJA/policy/sequential/sort.hpp"
+#include "RAJA/pattern/detail/algorithm.hpp"
+
+namespace RAJA
+{
+namespace impl
+{
+namespace sort
+{
+
+namespace detail
+{
+namespace thread_pool
+{
+
+// this number is arbitrary
+constexpr int get_min_iterates_per_task() { return 128; }
+
+/*!
+        \brief sort given range using sorter and comparison function
+               by manually assigning work to the first num_threads
+               members of the team
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline void sort_team(RAJA::thread_pool::Team const& team,
+                      RAJA::detail::IterDiff<Iter> num_threads,
+                      Sorter sorter,
+                      Iter begin,
+                      RAJA::detail::IterDiff<Iter> n,
+                      Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  const diff_type thread_id = team.thread_id();
+  const bool active = thread_id < num_threads;
+
+  const diff_type i_begin =
+      active ? firstIndex(n, num_threads, thread_id) : n;
+  if (active) {
+    const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+
+    // this thread sorts range [i_begin, i_end)
+    sorter(begin + i_begin, begin + i_end, comp);
+  }
+
+  // hierarchically merge ranges
+  for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
+
+    diff_type end_offset = 2*middle_offset;
+
+    team.sync();
+
+    if (active && thread_id % end_offset == 0) {
+
+      const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
+      const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
+
+      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
+      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
+    }
+  }
+}
+
+/*!
+        \brief sort given range using sorter and comparison function
+*/
+template <typename Sorter, typename Iter, typename Compare>
+inline
+void sort(Sorter sorter,
+          Iter begin,
+          Iter end,
+          Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  constexpr diff_type min_iterates_per_task = get_min_iterates_per_task();
+
+  const diff_type n = end - begin;
+
+  if (n <= min_iterates_per_task) {
+
+    sorter(begin, end, comp);
+
+  } else {
+
+    auto& pool = RAJA::thread_pool::ThreadPool::get();
+
+    const diff_type max_threads = pool.num_threads();
+
+    const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
+
+    pool.run([&](RAJA::thread_pool::Team const& team) {
+      const diff_type num_threads =
+          std::min(requested_num_threads, diff_type(team.num_threads()));
+      sort_team(team, num_threads, sorter, begin, n, comp);
+    });
+  }
+}
+
+} // namespace thread_pool
+
+} // namespace detail
+
+/*!
+        \brief sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+unstable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::thread_pool::sort(detail::UnstableSorter{}, begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range using comparison function
+*/
+template <typename ExecPolicy, typename Iter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+stable(
+    resources::Host host_res,
+    const ExecPolicy&,
+    Iter begin,
+    Iter end,
+    Compare comp)
+{
+  detail::thread_pool::sort(detail::StableSorter{}, begin, end, comp);
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+unstable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::thread_pool::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+/*!
+        \brief stable sort given range of pairs using comparison function on keys
+*/
+template <typename ExecPolicy, typename KeyIter, typename ValIter, typename Compare>
+concepts::enable_if_t<resources::EventProxy<resources::Host>,
+                      type_traits::is_thread_pool_policy<ExecPolicy>>
+stable_pairs(
+    resources::Host host_res,
+    const ExecPolicy&,
+    KeyIter keys_begin,
+    KeyIter keys_end,
+    ValIter vals_begin,
+    Compare comp)
+{
+  auto begin  = RAJA::zip(keys_begin, vals_begin);
+  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+  detail::thread_pool::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
+}  // namespace sort
+
+}  // namespace impl
+
+}  // namespace RAJA
+
+#endif  // closing endif for if defined(RAJA_ENABLE_THREAD_POOL)
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Chrome_Trace_Plugin_HPP
+#define RAJA_Chrome_Trace_Plugin_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that records the begin and end time of every kernel launch on
+   * every thread and writes them as a Chrome trace (JSON) file that can be
+   * opened in chrome://tracing or Perfetto.
+   *
+   * The plugin is active only if the RAJA_CHROME_TRACE environment variable
+   * names the output file. Each thread records into its own ring buffer of
+   * RAJA_CHROME_TRACE_EVENTS events (default 65536), so memory is bounded
+   * and the oldest events of a thread are dropped when it fills. The trace
+   * is written by finalize(), or when the program exits.
+   *
+   * Plugin hooks run only on the thread that launches a kernel, so an
+   * OpenMP kernel is one event on the launching thread that spans the whole
+   * parallel region. The trace does not show how the iterations were spread
+   * over the OpenMP threads, or any imbalance between them.
+   */
+  class ChromeTracePlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    using Parent = ::RAJA::util::PluginStrategy;
+
+    ChromeTracePlugin();
+
+    ~ChromeTracePlugin() override;
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+    //! Write the events recorded so far to path, returns false on failure
+    bool write(const std::string& path) const;
+
+  private:
+    struct Event
+    {
+      uint64_t begin_ns;
+      uint64_t end_ns;
+      uint64_t call_site_id;
+      uint64_t num_iterations;
+      const char* policy_name;
+      //! copy of the kernel name, or nullptr if the kernel has none
+      const std::string* kernel_name;
+      int platform;
+    };
+
+    struct ThreadBuffer;
+
+    ThreadBuffer* getThreadBuffer();
+
+    uint64_t now() const
+    {
+      return static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - m_start).count());
+    }
+
+    std::string m_path;
+    size_t m_capacity;
+    std::chrono::steady_clock::time_point m_start;
+    uint64_t m_id;
+
+    mutable std::mutex m_buffers_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+
+    bool m_written = false;
+
+  };  // end ChromeTracePlugin class
+
+  void linkChromeTracePlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
@@ -0,0 +1,151 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining FastDivisor, division by an invariant
+ *          integer with a multiply and shifts
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_FastDivisor_HPP
+#define RAJA_util_FastDivisor_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! High half of the full product of a and b
+RAJA_INLINE RAJA_HOST_DEVICE constexpr uint32_t mul_hi(uint32_t a, uint32_t b)
+{
+  return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> 32);
+}
+
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t mul_hi(uint64_t a, uint64_t b)
+{
+#if defined(RAJA_GPU_DEVICE_COMPILE_PASS_ACTIVE) && \
+    (defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__))
+  return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+  return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+  const uint64_t a_lo = a & 0xffffffffu;
+  const uint64_t a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffffu;
+  const uint64_t b_hi = b >> 32;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+  return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Division of non-negative integers by a divisor fixed at
+ *        construction, without a divide instruction.
+ *
+ * The constructor computes the magic number of Granlund and Montgomery,
+ * "Division by Invariant Integers using Multiplication" (PLDI 1994,
+ * figure 4.1), so that
+ *
+ *     n / d == (t + ((n - t) >> shift1)) >> shift2,  t = mul_hi(m, n)
+ *
+ * for every n representable in T, or every non-negative n for signed T.
+ * Values of 32 bits or less use a 32 bit multiply, larger ones a 64 bit
+ * multiply high.
+ *
+ * A default constructed FastDivisor divides by 1.
+ */
+template <typename T>
+struct FastDivisor {
+  static_assert(std::is_integral<T>::value && sizeof(T) <= 8,
+                "FastDivisor needs an integral type of at most 64 bits");
+
+  using value_type = T;
+  using word_type =
+      typename std::conditional<sizeof(T) <= 4, uint32_t, uint64_t>::type;
+
+  static constexpr int word_bits = 8 * sizeof(word_type);
+
+  word_type multiplier = 1;
+  int shift1 = 0;
+  int shift2 = 0;
+
+  constexpr RAJA_INLINE FastDivisor() = default;
+
+  /*!
+   * Precompute division by divisor, which must be positive.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr explicit FastDivisor(T divisor)
+      : multiplier{magic(static_cast<word_type>(divisor))},
+        shift1{ceil_log2(static_cast<word_type>(divisor)) > 0 ? 1 : 0},
+        shift2{ceil_log2(static_cast<word_type>(divisor)) > 0
+                   ? ceil_log2(static_cast<word_type>(divisor)) - 1
+                   : 0}
+  {
+  }
+
+  //! n / divisor, for non-negative n
+  RAJA_INLINE RAJA_HOST_DEVICE T divide(T n) const
+  {
+    const word_type w = static_cast<word_type>(n);
+    const word_type t = detail::mul_hi(multiplier, w);
+    return static_cast<T>((t + ((w - t) >> shift1)) >> shift2);
+  }
+
+private:
+  // smallest l with 2^l >= d
+  static RAJA_INLINE RAJA_HOST_DEVICE constexpr int ceil_log2(word_type d)
+  {
+    int l = 0;
+    while (l < word_bits && (word_type(1) << l) < d) {
+      ++l;
+    }
+    return l;
+  }
+
+  // floor(2^N * (2^l - d) / d) + 1, by long division as 2^l - d < d
+  static RAJA_INLINE RAJA_HOST_DEVICE constexpr word_type magic(word_type d)
+  {
+    const int l = ceil_log2(d);
+    word_type r = (l == word_bits ? word_type(0) : (word_type(1) << l)) - d;
+    word_type q = 0;
+    for (int i = 0; i < word_bits; ++i) {
+      const word_type carry = r >> (word_bits - 1);
+      r <<= 1;
+      q <<= 1;
+      if (carry || r >= d) {
+        r -= d;
+        q |= 1;
+      }
+    }
+    return q + 1;
+  }
+};
+
+template <typename T>
+constexpr int FastDivisor<T>::word_bits;
+
+}  // namespace RAJA
+
+#endif
@@ -0,0 +1,423 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file with the HostAsync resource, which runs host work
+ *          in order on a worker thread, and its forall, kernel and launch
+ *          overloads.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_HostAsync_HPP
+#define RAJA_HostAsync_HPP
+
+#include "RAJA/config.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/util/resource.hpp"
+
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/kernel.hpp"
+#include "RAJA/pattern/launch.hpp"
+
+namespace RAJA
+{
+namespace resources
+{
+
+namespace detail
+{
+
+/*!
+ * Tasks of a HostAsync resource and their completion count. The worker
+ * thread holds a reference to it, so events stay valid after the last
+ * HostAsync copy is gone and the worker drains the remaining tasks.
+ */
+class HostAsyncState
+{
+public:
+  uint64_t push(std::function<void()>&& task)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+    m_task_cv.notify_one();
+    return ++m_submitted;
+  }
+
+  uint64_t submitted() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_submitted;
+  }
+
+  bool complete(uint64_t ticket) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_completed >= ticket;
+  }
+
+  //! Wait for the task with the given ticket and all tasks before it,
+  //! rethrowing the first exception thrown by a task
+  void wait(uint64_t ticket)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [&]() { return m_completed >= ticket; });
+    if (m_error) {
+      std::exception_ptr error = m_error;
+      m_error = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  void stop()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+    m_task_cv.notify_one();
+  }
+
+  //! Worker loop, returns once stopped and all tasks are done
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+      m_task_cv.wait(lock, [&]() { return m_stop || !m_tasks.empty(); });
+      if (m_tasks.empty()) {
+        return;
+      }
+      std::function<void()> task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      lock.unlock();
+
+      std::exception_ptr error;
+      try {
+        task();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      // destroy the captured state, e.g. reducer copies that combine into
+      // their parent, before the task counts as done
+      task = nullptr;
+
+      lock.lock();
+      if (error && !m_error) {
+        m_error = error;
+      }
+      ++m_completed;
+      m_done_cv.notify_all();
+    }
+  }
+
+private:
+  mutable std::mutex m_mutex;
+  std::condition_variable m_task_cv;
+  std::condition_variable m_done_cv;
+  std::deque<std::function<void()>> m_tasks;
+  uint64_t m_submitted = 0;
+  uint64_t m_completed = 0;
+  bool m_stop = false;
+  std::exception_ptr m_error;
+};
+
+//! Owns the worker thread of a HostAsync resource and its copies
+class HostAsyncWorker
+{
+public:
+  HostAsyncWorker() : m_state(std::make_shared<HostAsyncState>())
+  {
+    std::shared_ptr<HostAsyncState> state = m_state;
+    m_thread = std::thread([state]() { state->run(); });
+  }
+
+  HostAsyncWorker(HostAsyncWorker const&) = delete;
+  HostAsyncWorker& operator=(HostAsyncWorker const&) = delete;
+
+  ~HostAsyncWorker()
+  {
+    m_state->stop();
+    if (m_thread.get_id() == std::this_thread::get_id()) {
+      // released by one of its own tasks, the thread finishes on its own
+      m_thread.detach();
+    } else {
+      m_thread.join();
+    }
+  }
+
+  std::shared_ptr<HostAsyncState> const& state() const { return m_state; }
+
+private:
+  std::shared_ptr<HostAsyncState> m_state;
+  std::thread m_thread;
+};
+
+}  // namespace detail
+
+/*!
+ * \brief Event of a HostAsync resource, complete when all work submitted
+ *        up to the time it was taken has run.
+ */
+class HostAsyncEvent
+{
+public:
+  HostAsyncEvent() = default;
+
+  HostAsyncEvent(std::shared_ptr<detail::HostAsyncState> state,
+                 uint64_t ticket)
+      : m_state(std::move(state)), m_ticket(ticket)
+  {
+  }
+
+  bool check() const { return !m_state || m_state->complete(m_ticket); }
+
+  void wait() const
+  {
+    if (m_state) {
+      m_state->wait(m_ticket);
+    }
+  }
+
+private:
+  std::shared_ptr<detail::HostAsyncState> m_state;
+  uint64_t m_ticket = 0;
+};
+
+/*!
+ * \brief Host resource that runs work asynchronously on a worker thread.
+ *
+ * Work submitted to a HostAsync resource, or to any of its copies, runs
+ * in submission order on the worker thread of the resource and the call
+ * returns right away. forall, kernel and launch calls with host execution
+ * policies run there with a Host resource, so OpenMP policies run on a
+ * team forked by the worker. Events returned by these calls, or by
+ * get_event, can be waited on, checked, or passed to wait_for of another
+ * resource to order work between them.
+ *
+ * Everything a submitted loop uses must stay valid until its event is
+ * complete. Reducers are read after waiting.
+ */
+class HostAsync
+{
+public:
+  using event_type = HostAsyncEvent;
+
+  //! New resource with its own worker thread
+  HostAsync() : m_worker(std::make_shared<detail::HostAsyncWorker>()) {}
+
+  static HostAsync get_default()
+  {
+    static HostAsync h;
+    return h;
+  }
+
+  Platform get_platform() const { return Platform::host; }
+
+  //! Queue a callable, the returned event completes once it has run
+  template <typename Task>
+  HostAsyncEvent enqueue(Task&& task)
+  {
+    std::shared_ptr<detail::HostAsyncState> const& state = m_worker->state();
+    const uint64_t ticket =
+        state->push(std::function<void()>(std::forward<Task>(task)));
+    return HostAsyncEvent(state, ticket);
+  }
+
+  HostAsyncEvent get_event() const
+  {
+    std::shared_ptr<detail::HostAsyncState> const& state = m_worker->state();
+    return HostAsyncEvent(state, state->submitted());
+  }
+
+  Event get_event_erased() const { return Event{get_event()}; }
+
+  //! Wait for all work submitted so far
+  void wait() const { get_event().wait(); }
+
+  //! Run work submitted later only after e is complete
+  void wait_for(Event* e)
+  {
+    Event event = *e;
+    enqueue([event]() { event.wait(); });
+  }
+
+  template <typename T>
+  T* allocate(size_t size)
+  {
+    return static_cast<T*>(std::malloc(sizeof(T) * size));
+  }
+
+  void* calloc(size_t size)
+  {
+    void* p = std::malloc(size);
+    std::memset(p, 0, size);
+    return p;
+  }
+
+  //! Freed after the work submitted before it
+  void deallocate(void* p)
+  {
+    enqueue([p]() { std::free(p); });
+  }
+
+  void memcpy(void* dst, const void* src, size_t size)
+  {
+    enqueue([=]() { std::memcpy(dst, src, size); });
+  }
+
+  void memset(void* p, int val, size_t size)
+  {
+    enqueue([=]() { std::memset(p, val, size); });
+  }
+
+  bool operator==(HostAsync const& other) const
+  {
+    return m_worker == other.m_worker;
+  }
+
+  bool operator!=(HostAsync const& other) const { return !(*this == other); }
+
+private:
+  std::shared_ptr<detail::HostAsyncWorker> m_worker;
+};
+
+}  // namespace resources
+
+namespace detail
+{
+
+template <typename ExecutionPolicy>
+struct check_host_async_policy {
+  static_assert(
+      std::is_same<typename resources::get_resource<ExecutionPolicy>::type,
+                   resources::Host>::value,
+      "HostAsync runs host execution policies only");
+  static constexpr bool value = true;
+};
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief forall on a HostAsync resource, queued to run on its worker.
+ *
+ ******************************************************************************
+ */
+template <typename ExecutionPolicy, typename... Args>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> forall(
+    resources::HostAsync r,
+    Args&&... args)
+{
+  static_assert(detail::check_host_async_policy<ExecutionPolicy>::value, "");
+  r.enqueue([=]() mutable {
+    ::RAJA::forall<ExecutionPolicy>(resources::Host::get_default(), args...);
+  });
+  return resources::EventProxy<resources::HostAsync>(r);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief kernel on a HostAsync resource, queued to run on its worker.
+ *
+ ******************************************************************************
+ */
+template <typename PolicyType,
+          typename SegmentTuple,
+          typename ParamTuple,
+          typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> kernel_param_resource(
+    SegmentTuple&& segments,
+    ParamTuple&& params,
+    resources::HostAsync resource,
+    Bodies&&... bodies)
+{
+  camp::decay<SegmentTuple> segs(std::forward<SegmentTuple>(segments));
+  camp::decay<ParamTuple> prms(std::forward<ParamTuple>(params));
+  resource.enqueue([=]() mutable {
+    ::RAJA::kernel_param_resource<PolicyType>(
+        segs, prms, resources::Host::get_default(), bodies...);
+  });
+  return resources::EventProxy<resources::HostAsync>(resource);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief kernel_resource on a HostAsync resource, queued to run on its
+ *        worker.
+ *
+ * The generic kernel_resource binds its call to kernel_param_resource
+ * before this header is included, so it needs its own overload.
+ *
+ ******************************************************************************
+ */
+template <typename PolicyType, typename SegmentTuple, typename... Bodies>
+RAJA_INLINE resources::EventProxy<resources::HostAsync> kernel_resource(
+    SegmentTuple&& segments,
+    resources::HostAsync resource,
+    Bodies&&... bodies)
+{
+  return ::RAJA::kernel_param_resource<PolicyType>(
+      std::forward<SegmentTuple>(segments),
+      RAJA::make_tuple(),
+      resource,
+      std::forward<Bodies>(bodies)...);
+}
+
+/*!
+ ******************************************************************************
+ *
+ * \brief launch on a HostAsync resource, queued to run on its worker.
+ *
+ ******************************************************************************
+ */
+template <typename POLICY_LIST, typename BODY>
+resources::EventProxy<resources::HostAsync> launch(
+    resources::HostAsync res,
+    LaunchParams const& params,
+    const char* kernel_name,
+    BODY const& body)
+{
+  res.enqueue([=]() {
+    ::RAJA::launch<POLICY_LIST>(
+        resources::Resource(resources::Host::get_default()),
+        params,
+        kernel_name,
+        body);
+  });
+  return resources::EventProxy<resources::HostAsync>(res);
+}
+
+template <typename POLICY_LIST, typename BODY>
+resources::EventProxy<resources::HostAsync> launch(
+    resources::HostAsync res,
+    LaunchParams const& params,
+    BODY const& body)
+{
+  return ::RAJA::launch<POLICY_LIST>(res, params, nullptr, body);
+}
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
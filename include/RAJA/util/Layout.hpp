@@ -28,6 +28,7 @@
 
 #include "RAJA/internal/foldl.hpp"
 
+#include "RAJA/util/FastDivisor.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
 
@@ -82,6 +83,8 @@ public:
   IdxLin strides[n_dims] = {0};
   IdxLin inv_strides[n_dims] = {0};
   IdxLin inv_mods[n_dims] = {0};
+  FastDivisor<IdxLin> div_strides[n_dims];
+  FastDivisor<IdxLin> div_mods[n_dims];
 
 
   /*!
@@ -105,7 +108,9 @@ public:
             sizes[RangeInts] ? IdxLin(1) : IdxLin(0),
             sizes))...},
         inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
-        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
+        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...},
+        div_strides{FastDivisor<IdxLin>(inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(inv_mods[RangeInts])...}
   {
     static_assert(n_dims == sizeof...(Types),
                   "number of dimensions must match");
@@ -121,7 +126,9 @@ public:
       : sizes{static_cast<IdxLin>(rhs.sizes[RangeInts])...},
         strides{static_cast<IdxLin>(rhs.strides[RangeInts])...},
         inv_strides{static_cast<IdxLin>(rhs.inv_strides[RangeInts])...},
-        inv_mods{static_cast<IdxLin>(rhs.inv_mods[RangeInts])...}
+        inv_mods{static_cast<IdxLin>(rhs.inv_mods[RangeInts])...},
+        div_strides{FastDivisor<IdxLin>(inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(inv_mods[RangeInts])...}
   {
   }
 
@@ -136,7 +143,9 @@ public:
       : sizes{sizes_in[RangeInts]...},
         strides{strides_in[RangeInts]...},
         inv_strides{(strides[RangeInts] ? strides[RangeInts] : IdxLin(1))...},
-        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...}
+        inv_mods{(sizes[RangeInts] ? sizes[RangeInts] : IdxLin(1))...},
+        div_strides{FastDivisor<IdxLin>(inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(inv_mods[RangeInts])...}
   {
   }
 
@@ -197,7 +206,11 @@ public:
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * Divisions by the strides and sizes use the multipliers precomputed
+   * when the layout was constructed, so this operation requires no integer
+   * divide instructions.
+   *
+   * linear_index must be non-negative.
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
@@ -215,10 +228,20 @@ public:
       RAJA_ABORT_OR_THROW("Out of bounds error \n");
      }
 #endif
+    assert(linear_index >= 0);
+
+    camp::sink((indices = (camp::decay<Indices>)(
+                    divmod<RangeInts>(linear_index)))...);
+  }
 
-    camp::sink((indices =
-      (camp::decay<Indices>)((linear_index / inv_strides[RangeInts]) %
-                             inv_mods[RangeInts]))...);
+  /*!
+   * (linear_index / strides) % sizes of dimension N, or 0 if projected
+   */
+  template <camp::idx_t N>
+  RAJA_INLINE RAJA_HOST_DEVICE IdxLin divmod(IdxLin linear_index) const
+  {
+    const IdxLin q = div_strides[N].divide(linear_index);
+    return q - inv_mods[N] * div_mods[N].divide(q);
   }
 
   /*!
@@ -367,7 +390,8 @@ struct TypedLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>
    * Given a linear-space index, compute the n-dimensional indices defined
    * by this layout.
    *
-   * Note that this operation requires 2n integer divide instructions
+   * Note that this operation requires no integer divide instructions, see
+   * LayoutBase_impl::toIndices
    *
    * @param linear_index  Linear space index to be converted to indices.
    * @param indices  Variadic list of indices to be assigned, number must match
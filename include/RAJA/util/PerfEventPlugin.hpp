@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_Perf_Event_Plugin_HPP
+#define RAJA_Perf_Event_Plugin_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+namespace RAJA {
+namespace util {
+
+  /*!
+   * Plugin that reads Linux perf_event hardware counters (cycles,
+   * instructions, last level cache misses and branch misses) on every
+   * OpenMP thread before and after each kernel, and sums the differences
+   * by kernel name.
+   *
+   * The plugin is active only if the RAJA_PERF_EVENTS environment variable
+   * is set. finalize() prints a summary table and, if RAJA_PERF_EVENTS
+   * names a file, writes the same data to it as CSV. Counters that cannot
+   * be opened are reported as unavailable; if none can be opened the plugin
+   * turns itself off.
+   *
+   * Only kernels launched outside of parallel regions by the thread that
+   * launched the first kernel are counted, nested kernels are part of the
+   * kernel that contains them.
+   */
+  class PerfEventPlugin : public ::RAJA::util::PluginStrategy
+  {
+  public:
+    using Parent = ::RAJA::util::PluginStrategy;
+
+    static constexpr int num_counters = 4;
+
+    PerfEventPlugin();
+
+    ~PerfEventPlugin() override;
+
+    void preLaunch(const RAJA::util::PluginContext& p) override;
+
+    void postLaunch(const RAJA::util::PluginContext& p) override;
+
+    void finalize() override;
+
+  private:
+    struct ThreadCounters
+    {
+      int leader_fd = -1;
+      std::vector<int> fds;
+    };
+
+    struct KernelCounters
+    {
+      std::string name;
+      uint64_t launches = 0;
+      uint64_t counts[num_counters] = {};
+    };
+
+    bool openCounters();
+
+    bool openThreadCounters(ThreadCounters& thread);
+
+    void readCounters(uint64_t* counts) const;
+
+    void closeCounters();
+
+    void printSummary() const;
+
+    bool writeCSV(const std::string& path) const;
+
+    std::string m_csv_path;
+    bool m_available[num_counters] = {};
+    //! read by every launching thread before the owner check
+    std::atomic<bool> m_disabled{true};
+    //! thread that counts kernels, the first one to launch one; hooks on
+    //! other threads return before touching the other members
+    std::atomic<std::thread::id> m_owner{std::thread::id()};
+    int m_depth = 0;
+
+    std::vector<ThreadCounters> m_threads;
+    uint64_t m_begin[num_counters] = {};
+
+    std::vector<KernelCounters> m_kernels;
+    std::unordered_map<uint64_t, size_t> m_call_sites;
+    std::unordered_map<std::string, size_t> m_names;
+
+  };  // end PerfEventPlugin class
+
+  void linkPerfEventPlugin();
+
+}  // end namespace util
+}  // end namespace RAJA
+
+#endif
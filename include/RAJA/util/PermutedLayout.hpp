@@ -87,6 +87,8 @@ auto make_permuted_layout(std::array<IdxLin, Rank> sizes,
     ret.strides[i] = strides[i];
     ret.inv_strides[i] = strides[i] ? strides[i] : 1;
     ret.inv_mods[i] = sizes[i] ? sizes[i] : 1;
+    ret.div_strides[i] = FastDivisor<IdxLin>(ret.inv_strides[i]);
+    ret.div_mods[i] = FastDivisor<IdxLin>(ret.inv_mods[i]);
   }
   return ret;
 }
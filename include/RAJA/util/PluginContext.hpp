@@ -8,6 +8,11 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
@@ -21,18 +26,140 @@ struct PluginContext {
     PluginContext(const Platform p) :
       platform(p) {}
 
+    PluginContext(const Platform p,
+                  const char* kernel_name_in,
+                  uint64_t call_site_id_in,
+                  const char* policy_name_in,
+                  size_t num_iterations_in) :
+      platform(p),
+      kernel_name(kernel_name_in),
+      call_site_id(call_site_id_in),
+      policy_name(policy_name_in),
+      num_iterations(num_iterations_in) {}
+
     Platform platform;
 
+    //! name given by RAJA::expt::KernelName or to launch, nullptr if none
+    const char* kernel_name = nullptr;
+
+    //! id of the calling kernel, the same in every run of an executable
+    uint64_t call_site_id = 0;
+
+    //! demangled name of the execution policy
+    const char* policy_name = "";
+
+    //! number of iterations in the iteration space, 0 if not known
+    size_t num_iterations = 0;
+
   private:
     mutable uint64_t kID;
 
     friend class KokkosPluginLoader;
 };
 
+namespace detail {
+
+template <typename T>
+const char* type_signature()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+/*!
+ * Extract the name of T from the signature of type_signature<T>
+ */
+inline std::string type_name_from_signature(std::string const& sig)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  const std::string prefix = "type_signature<";
+  const std::string suffix = ">(void)";
+#else
+  const std::string prefix = "T = ";
+  const std::string suffix = "]";
+#endif
+  const size_t begin = sig.find(prefix);
+  const size_t end = sig.rfind(suffix);
+  if (begin == std::string::npos || end == std::string::npos ||
+      end < begin + prefix.size()) {
+    return sig;
+  }
+  return sig.substr(begin + prefix.size(), end - begin - prefix.size());
+}
+
+/*!
+ * Demangled name of T, computed once per type
+ */
+template <typename T>
+const char* type_name()
+{
+  static const std::string name =
+      type_name_from_signature(type_signature<T>());
+  return name.c_str();
+}
+
+/*!
+ * 64-bit FNV-1a hash of a string
+ */
+inline uint64_t hash_string(const char* str, uint64_t hash = 14695981039346656037ull)
+{
+  for (; *str != '\0'; ++str) {
+    hash ^= static_cast<unsigned char>(*str);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+/*!
+ * Name of T that tells apart lambdas in the same scope, which the
+ * signature does not do on every compiler
+ */
+template <typename T>
+const char* unique_type_name()
+{
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+  return typeid(T).name();
+#else
+  return type_signature<T>();
+#endif
+}
+
+/*!
+ * Id of a kernel made from the types of its policy and body. Lambda types
+ * are unique to their call site and their names are the same in every
+ * run, unlike their addresses.
+ */
+template <typename Policy, typename Body>
+uint64_t call_site_id()
+{
+  static const uint64_t id =
+      hash_string(unique_type_name<Body>(), hash_string(unique_type_name<Policy>()));
+  return id;
+}
+
+} // closing brace for detail namespace
+
 template<typename Policy>
 PluginContext make_context()
 {
-  return PluginContext{detail::get_platform<Policy>::value};
+  return PluginContext{RAJA::detail::get_platform<Policy>::value,
+                       nullptr,
+                       0,
+                       detail::type_name<Policy>(),
+                       0};
+}
+
+template<typename Policy, typename Body>
+PluginContext make_context(const char* kernel_name, size_t num_iterations)
+{
+  return PluginContext{RAJA::detail::get_platform<Policy>::value,
+                       kernel_name,
+                       detail::call_site_id<Policy, Body>(),
+                       detail::type_name<Policy>(),
+                       num_iterations};
 }
 
 } // closing brace for util namespace
@@ -8,15 +8,26 @@
 #ifndef RAJA_Plugin_Linker_HPP
 #define RAJA_Plugin_Linker_HPP
 
+#include "RAJA/config.hpp"
+
+#include "RAJA/util/ChromeTracePlugin.hpp"
+#include "RAJA/util/PerfEventPlugin.hpp"
+
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
 #include "RAJA/util/RuntimePluginLoader.hpp"
 #include "RAJA/util/KokkosPluginLoader.hpp"
+#endif
 
 namespace {
   namespace anonymous_RAJA {
     struct pluginLinker {
       inline pluginLinker() {
+        (void)RAJA::util::linkChromeTracePlugin();
+        (void)RAJA::util::linkPerfEventPlugin();
+#if defined(RAJA_ENABLE_RUNTIME_PLUGINS)
         (void)RAJA::util::linkRuntimePluginLoader();
         (void)RAJA::util::linkKokkosPluginLoader();
+#endif
       }
     } pluginLinker;
   }
@@ -8,6 +8,8 @@
 #ifndef RAJA_PluginStrategy_HPP
 #define RAJA_PluginStrategy_HPP
 
+#include <atomic>
+
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/Registry.hpp"
@@ -15,12 +17,28 @@
 namespace RAJA {
 namespace util {
 
+namespace detail {
+
+//! Number of active plugins, hooks are skipped while it is zero
+extern RAJASHAREDDLL_API std::atomic<int> active_plugin_count;
+
+} // closing brace for detail namespace
+
 class PluginStrategy
 {
   public:
     RAJASHAREDDLL_API PluginStrategy();
 
-    virtual ~PluginStrategy() = default;
+    PluginStrategy(PluginStrategy const& other)
+      : PluginStrategy(other.m_active) {}
+
+    PluginStrategy& operator=(PluginStrategy const& other)
+    {
+      setActive(other.m_active);
+      return *this;
+    }
+
+    virtual RAJASHAREDDLL_API ~PluginStrategy();
 
     virtual RAJASHAREDDLL_API void init(const PluginOptions& p);
 
@@ -33,6 +51,17 @@ class PluginStrategy
     virtual RAJASHAREDDLL_API void postLaunch(const PluginContext& p);
 
     virtual RAJASHAREDDLL_API void finalize();
+
+  protected:
+    //! Plugins that only forward to other plugins, like the plugin
+    //! loaders, start inactive and call setActive when they have
+    //! something to call
+    RAJASHAREDDLL_API explicit PluginStrategy(bool active);
+
+    RAJASHAREDDLL_API void setActive(bool active);
+
+  private:
+    bool m_active = false;
 };
 
 using PluginRegistry = Registry<PluginStrategy>;
@@ -0,0 +1,296 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining ReproSum, a floating point accumulator
+ *          whose result does not depend on the order of the additions, and
+ *          the repro_plus operator used to reduce with it.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ReproSum_HPP
+#define RAJA_util_ReproSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "RAJA/util/Operators.hpp"
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ * @brief Accumulator for sums of float or double values that gives the same
+ *        result for any order and grouping of the additions.
+ *
+ * Each value is split by its exponent into fixed bins of 32 bits, aligned
+ * to the smallest subnormal, and its mantissa is added to at most three
+ * bins as integers. Carries between bins are only propagated every 2^29
+ * additions, so adding a value costs a few integer operations. Since the
+ * bins hold the sum exactly, partial sums accumulated by any number of
+ * threads over any partition of the data merge to the same state, and get()
+ * rounds that exact sum to T once, so the result is also accurate for sums
+ * with cancellation.
+ *
+ * Infinities and NaNs are summed separately and returned if there were any.
+ */
+template <typename T>
+class ReproSum
+{
+  static_assert(std::is_floating_point<T>::value &&
+                    std::numeric_limits<T>::digits <= 53 &&
+                    std::numeric_limits<T>::max_exponent <= 1024,
+                "ReproSum accumulates float or double values");
+
+public:
+  using value_type = T;
+
+  ReproSum() = default;
+
+  //! Accumulator holding val, so that values convert to partial sums
+  ReproSum(T val) { add(static_cast<double>(val)); }
+
+  ReproSum& operator+=(T val)
+  {
+    add(static_cast<double>(val));
+    return *this;
+  }
+
+  ReproSum& operator+=(ReproSum const& other)
+  {
+    for (int i = 0; i < num_bins; ++i) {
+      m_bins[i] += other.m_bins[i];
+    }
+    m_special += other.m_special;
+    m_deposits += other.m_deposits;
+    if (m_deposits >= max_deposits) {
+      normalize();
+    }
+    return *this;
+  }
+
+  //! The sum rounded to T
+  T get() const
+  {
+    if (m_special != 0.0 || m_special != m_special) {
+      return static_cast<T>(m_special);
+    }
+
+    ReproSum sum(*this);
+    sum.normalize();
+
+    const bool negative = sum.m_bins[num_bins - 1] < 0;
+    if (negative) {
+      for (int i = 0; i < num_bins; ++i) {
+        sum.m_bins[i] = -sum.m_bins[i];
+      }
+      sum.normalize();
+    }
+
+    int top = num_bins - 1;
+    while (top >= 0 && sum.m_bins[top] == 0) {
+      --top;
+    }
+    if (top < 0) {
+      return T(0);
+    }
+
+    const T result = sum.round_magnitude(top);
+    return negative ? -result : result;
+  }
+
+private:
+  static constexpr int bin_bits = 32;
+  static constexpr int64_t bin_mask = (int64_t(1) << bin_bits) - 1;
+  // bit 0 of bin 0 is the smallest double subnormal, 2^-1074, and the bins
+  // reach past the largest double with room for carries
+  static constexpr int num_bins = 68;
+  // each addition adds less than 2^33 to a bin, so 2^29 of them fit
+  static constexpr int64_t max_deposits = int64_t(1) << 29;
+
+  int64_t m_bins[num_bins] = {0};
+  int64_t m_deposits = 0;
+  double m_special = 0.0;
+
+  void add(double val)
+  {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &val, sizeof(double));
+
+    const int exponent = static_cast<int>((bits >> 52) & 0x7ff);
+    if (exponent == 0x7ff) {
+      m_special += val;
+      return;
+    }
+    uint64_t mantissa = bits & ((uint64_t(1) << 52) - 1);
+    if (exponent != 0) {
+      mantissa |= uint64_t(1) << 52;
+    }
+
+    // val is mantissa * 2^(pos - 1074)
+    const int pos = (exponent != 0 ? exponent : 1) - 1;
+    const int bin = pos / bin_bits;
+    const int shift = pos % bin_bits;
+
+    const uint64_t lo = (mantissa & uint64_t(bin_mask)) << shift;
+    const uint64_t hi = (mantissa >> bin_bits) << shift;
+    const int64_t part0 = static_cast<int64_t>(lo & uint64_t(bin_mask));
+    const int64_t part1 = static_cast<int64_t>((lo >> bin_bits) +
+                                               (hi & uint64_t(bin_mask)));
+    const int64_t part2 = static_cast<int64_t>(hi >> bin_bits);
+
+    // negate the parts of negative values without a branch
+    const int64_t sign = -static_cast<int64_t>(bits >> 63);
+    m_bins[bin] += (part0 ^ sign) - sign;
+    m_bins[bin + 1] += (part1 ^ sign) - sign;
+    m_bins[bin + 2] += (part2 ^ sign) - sign;
+
+    if (++m_deposits >= max_deposits) {
+      normalize();
+    }
+  }
+
+  // propagate carries so every bin but the last is in [0, 2^32)
+  void normalize()
+  {
+    for (int i = 0; i < num_bins - 1; ++i) {
+      const int64_t low = static_cast<int64_t>(
+          static_cast<uint64_t>(m_bins[i]) & uint64_t(bin_mask));
+      m_bins[i + 1] += (m_bins[i] - low) / (int64_t(1) << bin_bits);
+      m_bins[i] = low;
+    }
+    m_deposits = 0;
+  }
+
+  // round the normalized, non-negative sum with highest non-zero bin top
+  // to T, in one step so that float results are not rounded to double first
+  T round_magnitude(int top) const
+  {
+    auto bin = [&](int i) -> uint64_t {
+      return i >= 0 ? static_cast<uint64_t>(m_bins[i]) : 0;
+    };
+
+    int lead = 0;
+    while (lead < bin_bits && (bin(top) >> lead) != 0) {
+      ++lead;
+    }
+
+    // take at least 55 leading bits, so that the rest only matters as a
+    // sticky bit for round to nearest even
+    uint64_t bits = (bin(top) << bin_bits) | bin(top - 1);
+    int low_pos = bin_bits * (top - 1);
+    bool sticky = false;
+    int rest = top - 2;
+    if (lead + bin_bits < 55) {
+      const int take = bin_bits - lead;
+      bits = (bits << take) | (bin(top - 2) >> lead);
+      sticky = (bin(top - 2) & ((uint64_t(1) << lead) - 1)) != 0;
+      low_pos -= take;
+      rest = top - 3;
+    }
+    for (int i = rest; i >= 0 && !sticky; --i) {
+      sticky = m_bins[i] != 0;
+    }
+    if (sticky) {
+      bits |= 1;
+    }
+
+    // the sum is bits * 2^exponent, and round to nearest even at the last
+    // digit of T, or at its smallest subnormal
+    const int exponent = low_pos - 1074;
+    int msb = 63;
+    while ((bits >> msb) == 0) {
+      --msb;
+    }
+    constexpr int digits = std::numeric_limits<T>::digits;
+    constexpr int min_ulp = std::numeric_limits<T>::min_exponent - digits;
+    const int ulp = msb + exponent - (digits - 1) > min_ulp
+                        ? msb + exponent - (digits - 1)
+                        : min_ulp;
+    const int shift = ulp - exponent;
+    if (shift <= 0) {
+      return std::ldexp(static_cast<T>(bits), exponent);
+    }
+
+    // with a sticky bit there are at least 55 bits, so shift >= 2 and the
+    // sticky bit is below the half bit
+    uint64_t mantissa = 0;
+    bool round_up = false;
+    if (shift < 64) {
+      mantissa = bits >> shift;
+      const uint64_t rest = bits & ((uint64_t(1) << shift) - 1);
+      const uint64_t half = uint64_t(1) << (shift - 1);
+      round_up = rest > half || (rest == half && (mantissa & 1) != 0);
+    } else if (shift == 64) {
+      round_up = bits > (uint64_t(1) << 63);
+    }
+    if (round_up) {
+      ++mantissa;
+    }
+
+    return std::ldexp(static_cast<T>(mantissa), ulp);
+  }
+};
+
+template <typename T>
+constexpr int ReproSum<T>::bin_bits;
+template <typename T>
+constexpr int64_t ReproSum<T>::bin_mask;
+template <typename T>
+constexpr int ReproSum<T>::num_bins;
+template <typename T>
+constexpr int64_t ReproSum<T>::max_deposits;
+
+namespace operators
+{
+
+/*!
+ * @brief Sum reduced through ReproSum partial sums, for reductions whose
+ *        result must not depend on the number of threads.
+ *
+ * On plain values it is plus.
+ */
+template <typename Ret, typename Arg1 = Ret, typename Arg2 = Arg1>
+struct repro_plus : public detail::binary_function<Arg1, Arg2, Ret>,
+                    detail::associative_tag {
+  RAJA_HOST_DEVICE constexpr Ret operator()(const Arg1& lhs,
+                                            const Arg2& rhs) const
+  {
+    return Ret{lhs} + rhs;
+  }
+
+  ReproSum<Ret> operator()(ReproSum<Ret> lhs, ReproSum<Ret> const& rhs) const
+  {
+    lhs += rhs;
+    return lhs;
+  }
+
+  Ret operator()(ReproSum<Ret> lhs, const Arg2& rhs) const
+  {
+    lhs += rhs;
+    return lhs.get();
+  }
+
+  RAJA_HOST_DEVICE static constexpr Ret identity() { return Ret{0}; }
+};
+
+}  // namespace operators
+
+}  // namespace RAJA
+
+#endif
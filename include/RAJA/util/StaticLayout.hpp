@@ -23,6 +23,7 @@
 
 #include <iostream>
 #include <limits>
+#include <type_traits>
 
 #include "RAJA/index/IndexValue.hpp"
 
@@ -102,6 +103,37 @@ struct StaticLayoutBase_impl<IdxLin,
   }
 
 
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * The strides and sizes are compile-time constants, so the compiler turns
+   * the unsigned divisions into multiplies and shifts. linear_index must be
+   * non-negative.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  static RAJA_INLINE RAJA_HOST_DEVICE void s_toIndices(IdxLin linear_index,
+                                                       Indices &... indices)
+  {
+    using UIdxLin = typename std::make_unsigned<IdxLin>::type;
+    camp::sink((indices = static_cast<Indices>(
+                    (static_cast<UIdxLin>(linear_index) /
+                     static_cast<UIdxLin>(Strides ? Strides : 1)) %
+                    static_cast<UIdxLin>(Sizes ? Sizes : 1)))...);
+  }
+
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &... indices) const
+  {
+    s_toIndices(linear_index, indices...);
+  }
+
+
   // Multiply together all of the sizes,
   // replacing 1 for any zero-sized dimensions
   static constexpr IdxLin s_size =
@@ -248,6 +280,27 @@ struct StaticLayoutBase_impl<IdxLin,
   }
 
 
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout, see the untyped s_toIndices.
+   */
+  static RAJA_INLINE RAJA_HOST_DEVICE void s_toIndices(
+      IndexLinear linear_index,
+      DimTypes &... indices)
+  {
+    IndexLinear locals[sizeof...(DimTypes)];
+    InnerLayout::s_toIndices(stripIndexType(linear_index),
+                             locals[RangeInts]...);
+    camp::sink((indices = DimTypes{static_cast<DimTypes>(locals[RangeInts])})...);
+  }
+
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IndexLinear linear_index,
+                                              DimTypes &... indices) const
+  {
+    s_toIndices(linear_index, indices...);
+  }
+
+
   static constexpr IndexLinear s_size = InnerLayout::s_size;
   static constexpr IndexLinear s_size_noproj = InnerLayout::s_size_noproj;
 
@@ -0,0 +1,392 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file with a database of tuned tile sizes for
+ *          RAJA::kernel statement::Tile with tile_dynamic, and a harness
+ *          that finds them.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_TileTuning_HPP
+#define RAJA_TileTuning_HPP
+
+#include "RAJA/config.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+#include "RAJA/pattern/kernel/Tile.hpp"
+
+namespace RAJA
+{
+namespace util
+{
+
+/*!
+ * \brief Tile sizes of named kernels by problem shape and thread count.
+ *
+ * The database is a text file with one entry per line:
+ *
+ *   kernel_name num_threads shape tiles seconds
+ *
+ * where shape and tiles are lists of sizes separated by 'x', for example
+ *
+ *   transpose 32 4096x4096 64x16 0.0123
+ *
+ * Lines starting with '#' are comments. Kernel names must not contain
+ * white space.
+ */
+class TileTuningDatabase
+{
+public:
+  using Sizes = std::vector<camp::idx_t>;
+
+  struct Entry {
+    std::string kernel;
+    int num_threads;
+    Sizes shape;
+    Sizes tiles;
+    double seconds;
+  };
+
+  /*!
+   * Database used by tuned_tile_sizes and tune_tile_sizes. On first use it
+   * loads the file named by the RAJA_TILE_TUNING_DB environment variable.
+   */
+  static TileTuningDatabase& instance()
+  {
+    static TileTuningDatabase db = []() {
+      TileTuningDatabase loaded;
+      const char* path = ::getenv("RAJA_TILE_TUNING_DB");
+      if (nullptr != path && '\0' != path[0]) {
+        loaded.load(path);
+      }
+      return loaded;
+    }();
+    return db;
+  }
+
+  TileTuningDatabase() = default;
+
+  TileTuningDatabase(TileTuningDatabase&& other)
+      : m_entries(std::move(other.m_entries))
+  {
+  }
+
+  //! Add the entries in a file, returns false if it cannot be read
+  bool load(const std::string& path)
+  {
+    std::ifstream in(path);
+    if (!in) {
+      printf("[TileTuningDatabase]: could not open %s\n", path.c_str());
+      return false;
+    }
+
+    bool ok = true;
+    std::string line;
+    for (int line_number = 1; std::getline(in, line); ++line_number) {
+      const size_t first = line.find_first_not_of(" \t\r");
+      if (first == std::string::npos || line[first] == '#') {
+        continue;
+      }
+
+      std::istringstream fields(line);
+      Entry entry;
+      std::string shape, tiles;
+      if (!(fields >> entry.kernel >> entry.num_threads >> shape >> tiles >>
+            entry.seconds) ||
+          !parseSizes(shape, entry.shape) || !parseSizes(tiles, entry.tiles)) {
+        printf("[TileTuningDatabase]: %s:%d: malformed entry\n",
+               path.c_str(),
+               line_number);
+        ok = false;
+        continue;
+      }
+      insert(entry);
+    }
+    return ok;
+  }
+
+  //! Write all entries to a file, returns false if it cannot be written
+  bool save(const std::string& path) const
+  {
+    std::ofstream out(path);
+    if (!out) {
+      printf("[TileTuningDatabase]: could not open %s\n", path.c_str());
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    out << "# kernel_name num_threads shape tiles seconds\n";
+    for (Entry const& entry : m_entries) {
+      out << entry.kernel << ' ' << entry.num_threads << ' '
+          << formatSizes(entry.shape) << ' ' << formatSizes(entry.tiles) << ' '
+          << entry.seconds << '\n';
+    }
+    return static_cast<bool>(out);
+  }
+
+  //! Add an entry, replacing the entry with the same kernel, shape and
+  //! thread count
+  void insert(Entry const& entry)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (Entry& existing : m_entries) {
+      if (existing.kernel == entry.kernel &&
+          existing.num_threads == entry.num_threads &&
+          existing.shape == entry.shape) {
+        existing = entry;
+        return;
+      }
+    }
+    m_entries.push_back(entry);
+  }
+
+  /*!
+   * Find the tile sizes for a kernel. Without an exact match the entry of
+   * the kernel with the same number of tiles and dimensions that is
+   * closest in log scale in shape and thread count is used. If tiles is
+   * not empty only entries with as many tiles are used. Returns false if
+   * the kernel has no such entry.
+   */
+  bool lookup(const std::string& kernel,
+              Sizes const& shape,
+              int num_threads,
+              Sizes& tiles) const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const Entry* closest = nullptr;
+    double closest_distance = std::numeric_limits<double>::max();
+    for (Entry const& entry : m_entries) {
+      if (entry.kernel != kernel || entry.shape.size() != shape.size() ||
+          (!tiles.empty() && entry.tiles.size() != tiles.size())) {
+        continue;
+      }
+      double distance = logDistance(entry.num_threads, num_threads);
+      for (size_t d = 0; d < shape.size(); ++d) {
+        distance += logDistance(entry.shape[d], shape[d]);
+      }
+      if (distance < closest_distance) {
+        closest = &entry;
+        closest_distance = distance;
+      }
+    }
+
+    if (nullptr == closest) {
+      return false;
+    }
+    tiles = closest->tiles;
+    return true;
+  }
+
+  size_t size() const
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+  }
+
+private:
+  static bool parseSizes(std::string const& str, Sizes& sizes)
+  {
+    sizes.clear();
+    std::istringstream in(str);
+    std::string size;
+    while (std::getline(in, size, 'x')) {
+      char* end = nullptr;
+      const long long value = std::strtoll(size.c_str(), &end, 10);
+      if (size.empty() || *end != '\0' || value <= 0) {
+        return false;
+      }
+      sizes.push_back(static_cast<camp::idx_t>(value));
+    }
+    return !sizes.empty();
+  }
+
+  static std::string formatSizes(Sizes const& sizes)
+  {
+    std::string str;
+    for (size_t d = 0; d < sizes.size(); ++d) {
+      if (d > 0) {
+        str += 'x';
+      }
+      str += std::to_string(sizes[d]);
+    }
+    return str;
+  }
+
+  static double logDistance(double a, double b)
+  {
+    return std::fabs(std::log2((a > 0 ? a : 1) / (b > 0 ? b : 1)));
+  }
+
+  std::vector<Entry> m_entries;
+  mutable std::mutex m_mutex;
+};
+
+namespace detail
+{
+
+inline int tile_tuning_num_threads()
+{
+#if defined(RAJA_ENABLE_OPENMP)
+  return omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+template <typename T>
+using as_tile_size = TileSize;
+
+template <camp::idx_t... Is>
+camp::tuple<as_tile_size<camp::num<Is>>...> make_tile_sizes(
+    TileTuningDatabase::Sizes const& tiles,
+    camp::idx_seq<Is...>)
+{
+  return camp::make_tuple(TileSize{tiles[Is]}...);
+}
+
+}  // namespace detail
+
+/*!
+ * \brief Tile sizes for a kernel from the tuning database, to pass as the
+ *        parameters referenced by tile_dynamic in RAJA::kernel_param.
+ *
+ * The default sizes are returned if the database has no entry for the
+ * kernel, for example
+ *
+ *   auto tiles = RAJA::util::tuned_tile_sizes("transpose", {N, M}, 32, 32);
+ */
+template <typename... Defaults>
+camp::tuple<detail::as_tile_size<Defaults>...> tuned_tile_sizes(
+    const std::string& kernel,
+    TileTuningDatabase::Sizes const& shape,
+    Defaults... default_sizes)
+{
+  TileTuningDatabase::Sizes tiles(sizeof...(Defaults));
+  if (!TileTuningDatabase::instance().lookup(
+          kernel, shape, detail::tile_tuning_num_threads(), tiles)) {
+    tiles = TileTuningDatabase::Sizes{
+        static_cast<camp::idx_t>(default_sizes)...};
+  }
+  return detail::make_tile_sizes(tiles,
+                                 camp::make_idx_seq_t<sizeof...(Defaults)>{});
+}
+
+/*!
+ * \brief Time run(tile_sizes) for every combination of the candidate tile
+ *        sizes, store the fastest in the tuning database and return it.
+ *
+ * Each combination is run once to warm up and then timed repeats times,
+ * which must be at least 1; the fastest of those runs is its time. run
+ * must finish its work before returning.
+ */
+template <size_t NumTiles, typename Run>
+auto tune_tile_sizes(
+    const std::string& kernel,
+    TileTuningDatabase::Sizes const& shape,
+    std::array<TileTuningDatabase::Sizes, NumTiles> const& candidates,
+    Run&& run,
+    int repeats = 3)
+    -> decltype(detail::make_tile_sizes(
+        TileTuningDatabase::Sizes{},
+        camp::make_idx_seq_t<NumTiles>{}))
+{
+  using seq = camp::make_idx_seq_t<NumTiles>;
+
+  if (repeats < 1) {
+    RAJA_ABORT_OR_THROW("tune_tile_sizes needs at least one timed repeat");
+  }
+  for (auto const& sizes : candidates) {
+    if (sizes.empty()) {
+      RAJA_ABORT_OR_THROW("tune_tile_sizes needs candidates for every tile");
+    }
+  }
+
+  TileTuningDatabase::Sizes tiles(NumTiles);
+  TileTuningDatabase::Sizes best;
+  double best_seconds = std::numeric_limits<double>::max();
+
+  // odometer over the cartesian product of the candidates
+  std::array<size_t, NumTiles> position{};
+  for (bool done = false; !done;) {
+    for (size_t d = 0; d < NumTiles; ++d) {
+      tiles[d] = candidates[d][position[d]];
+    }
+
+    run(detail::make_tile_sizes(tiles, seq{}));
+
+    double seconds = std::numeric_limits<double>::max();
+    for (int r = 0; r < repeats; ++r) {
+      const auto start = std::chrono::steady_clock::now();
+      run(detail::make_tile_sizes(tiles, seq{}));
+      const auto stop = std::chrono::steady_clock::now();
+      const double t = std::chrono::duration<double>(stop - start).count();
+      if (t < seconds) {
+        seconds = t;
+      }
+    }
+
+    if (seconds < best_seconds) {
+      best_seconds = seconds;
+      best = tiles;
+    }
+
+    done = true;
+    for (size_t d = 0; d < NumTiles; ++d) {
+      if (++position[d] < candidates[d].size()) {
+        done = false;
+        break;
+      }
+      position[d] = 0;
+    }
+  }
+
+  TileTuningDatabase::instance().insert(
+      TileTuningDatabase::Entry{kernel,
+                                detail::tile_tuning_num_threads(),
+                                shape,
+                                best,
+                                best_seconds});
+
+  return detail::make_tile_sizes(best, seq{});
+}
+
+}  // namespace util
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
@@ -18,12 +18,17 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <list>
 #include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -116,7 +121,7 @@ public:
     return ptr_out;
   }
 
-  bool give(void* ptr)
+  bool give(void* ptr, size_t* nbytes = nullptr)
   {
     if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
 
@@ -124,6 +129,11 @@ public:
 
       if (found != m_used_space.end()) {
 
+        if (nbytes != nullptr) {
+          *nbytes = static_cast<char*>(found->second) -
+                    static_cast<char*>(found->first);
+        }
+
         add_free_chunk(found->first, found->second);
 
         m_used_space.erase(found);
@@ -239,9 +249,60 @@ private:
   used_type m_used_space;
 };
 
+/*!
+ * \brief Index of the calling thread, used by MemPool to pick a thread cache.
+ */
+inline size_t mempool_thread_index()
+{
+  static std::atomic<size_t> s_next_index{0};
+  static thread_local size_t t_index = s_next_index.fetch_add(1);
+  return t_index;
+}
+
 } /* end namespace detail */
 
 
+/*!
+ * \brief Pool mode that divides large arenas first-fit, the default.
+ */
+struct arena_mode {
+};
+
+/*!
+ * \brief Pool mode that rounds allocations up to power of two size classes
+ * kept in free lists with per-thread caches.
+ */
+struct size_class_mode {
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Usage statistics reported by MemPool::statistics().
+ *
+ ******************************************************************************
+ */
+struct mempool_statistics {
+  //! bytes obtained from the allocator
+  size_t reserved_bytes = 0;
+  //! bytes currently handed out, including alignment or size class rounding
+  size_t used_bytes = 0;
+  //! largest value used_bytes has reached
+  size_t high_water_mark_bytes = 0;
+  //! number of allocations currently handed out
+  size_t num_allocations = 0;
+
+  //! fraction of reserved bytes that are not handed out
+  double fragmentation() const
+  {
+    return (reserved_bytes == 0)
+               ? 0.0
+               : 1.0 - static_cast<double>(used_bytes) /
+                           static_cast<double>(reserved_bytes);
+  }
+};
+
+
 /*! \class MemPool
  ******************************************************************************
  *
@@ -260,6 +321,12 @@ private:
  *basic_mempool::MemPool<cuda::DeviceZeroedAllocator>;
  * using pinned_mempool_type = basic_mempool::MemPool<cuda::PinnedAllocator>;
  *
+ * The pool mode may be given as a second template argument, the default
+ * arena_mode or size_class_mode, for example
+ *
+ * using pool_type = basic_mempool::MemPool<cuda::DeviceAllocator,
+ *                                          basic_mempool::size_class_mode>;
+ *
  * The user provides the specialized allocator, for example :
  * struct DeviceAllocator {
  *
@@ -282,11 +349,12 @@ private:
  *
  ******************************************************************************
  */
-template <typename allocator_t>
+template <typename allocator_t, typename mode_t = arena_mode>
 class MemPool
 {
 public:
   using allocator_type = allocator_t;
+  using mode_type = mode_t;
 
   static inline MemPool<allocator_t>& getInstance()
   {
@@ -320,6 +388,10 @@ public:
       m_alloc.free(allocation_ptr);
       m_arenas.pop_front();
     }
+
+    m_stats.reserved_bytes = 0;
+    m_stats.used_bytes = 0;
+    m_stats.num_allocations = 0;
   }
 
   size_t arena_size()
@@ -366,10 +438,18 @@ public:
       void* arena_ptr = m_alloc.malloc(alloc_size);
       if (arena_ptr != nullptr) {
         m_arenas.emplace_front(arena_ptr, alloc_size);
+        m_stats.reserved_bytes += alloc_size;
         ptr = m_arenas.front().get(size, alignment);
       }
     }
 
+    if (ptr != nullptr) {
+      m_stats.used_bytes += size;
+      m_stats.num_allocations += 1;
+      m_stats.high_water_mark_bytes =
+          std::max(m_stats.high_water_mark_bytes, m_stats.used_bytes);
+    }
+
     return static_cast<T*>(ptr);
   }
 
@@ -383,7 +463,10 @@ public:
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
-      if (iter->give(ptr)) {
+      size_t nbytes = 0;
+      if (iter->give(ptr, &nbytes)) {
+        m_stats.used_bytes -= nbytes;
+        m_stats.num_allocations -= 1;
         ptr = nullptr;
         break;
       }
@@ -393,6 +476,15 @@ public:
     }
   }
 
+  mempool_statistics statistics()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    return m_stats;
+  }
+
 private:
   using arena_container_type = std::list<detail::MemoryArena>;
 
@@ -403,8 +495,390 @@ private:
   arena_container_type m_arenas;
   size_t m_default_arena_size;
   allocator_t m_alloc;
+  mempool_statistics m_stats;
 };
 
+/*! \class MemPool<allocator_t, size_class_mode>
+ ******************************************************************************
+ *
+ * \brief  MemPool mode that rounds allocations up to power of two size
+ * classes. Each class keeps a free list of blocks carved from slabs obtained
+ * from the allocator, and each thread keeps a small cache of free blocks per
+ * class so most malloc/free calls take only an uncontended lock.
+ *
+ * Pool bookkeeping lives in host memory, so the allocator may return memory
+ * the host can not access. Requests larger than the largest class or with
+ * alignment above max_block_alignment are passed to the allocator directly.
+ *
+ ******************************************************************************
+ */
+template <typename allocator_t>
+class MemPool<allocator_t, size_class_mode>
+{
+public:
+  using allocator_type = allocator_t;
+  using mode_type = size_class_mode;
+
+  static inline MemPool<allocator_t, size_class_mode>& getInstance()
+  {
+    static MemPool<allocator_t, size_class_mode> pool{};
+    return pool;
+  }
+
+  static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
+
+  //! size of the smallest size class
+  static constexpr size_t min_block_size = 256;
+  //! blocks are aligned to their size up to this alignment
+  static constexpr size_t max_block_alignment = 256;
+  //! number of size classes, from min_block_size to 32MiB
+  static constexpr size_t num_size_classes = 18;
+  //! number of thread caches, threads share caches beyond this
+  static constexpr size_t num_thread_caches = 64;
+  //! number of blocks moved between a thread cache and a free list at once
+  static constexpr size_t cache_batch_size = 8;
+
+  MemPool() : m_default_arena_size(default_default_arena_size), m_alloc() {}
+
+  ~MemPool()
+  {
+    // With static objects like MemPool, cudaErrorCudartUnloading is a possible
+    // error with cudaFree
+    // So no more cuda calls here
+  }
+
+  void free_chunks()
+  {
+    // blocks must not be in use, so the caches and free lists are cleared
+    // one at a time before the slabs are returned to the allocator
+    for (size_t c = 0; c < num_thread_caches; ++c) {
+      lock_guard<std::mutex> lock(m_caches[c].mutex);
+      for (size_t k = 0; k < num_size_classes; ++k) {
+        m_caches[c].free_blocks[k].clear();
+      }
+    }
+    for (size_t k = 0; k < num_size_classes; ++k) {
+      lock_guard<std::mutex> lock(m_classes[k].mutex);
+      m_classes[k].free_blocks.clear();
+    }
+    for (size_t r = 0; r < num_registry_shards; ++r) {
+      lock_guard<std::mutex> lock(m_registry[r].mutex);
+      m_registry[r].block_class.clear();
+    }
+
+    lock_guard<std::mutex> lock(m_mutex);
+
+    for (void* slab_ptr : m_slabs) {
+      m_alloc.free(slab_ptr);
+    }
+    m_slabs.clear();
+    for (auto& large : m_large) {
+      m_alloc.free(large.second.allocation);
+    }
+    m_large.clear();
+
+    m_reserved_bytes = 0;
+    m_used_bytes = 0;
+    m_num_allocations = 0;
+  }
+
+  size_t arena_size()
+  {
+    lock_guard<std::mutex> lock(m_mutex);
+
+    return m_default_arena_size;
+  }
+
+  size_t arena_size(size_t new_size)
+  {
+    lock_guard<std::mutex> lock(m_mutex);
+
+    size_t prev_size = m_default_arena_size;
+    m_default_arena_size = new_size;
+    return prev_size;
+  }
+
+  template <typename T>
+  T* malloc(size_t nTs, size_t alignment = alignof(T))
+  {
+    const size_t size = nTs * sizeof(T);
+    const size_t k = get_size_class(size, alignment);
+
+    void* ptr = nullptr;
+    if (k == num_size_classes) {
+      ptr = malloc_large(size, alignment);
+    } else {
+      thread_cache& cache =
+          m_caches[detail::mempool_thread_index() % num_thread_caches];
+
+      lock_guard<std::mutex> lock(cache.mutex);
+      std::vector<void*>& blocks = cache.free_blocks[k];
+      if (blocks.empty()) {
+        refill(k, blocks);
+      }
+      if (!blocks.empty()) {
+        ptr = blocks.back();
+        blocks.pop_back();
+      }
+      if (ptr != nullptr) {
+        add_used(get_block_size(k));
+      }
+    }
+
+    return static_cast<T*>(ptr);
+  }
+
+  void free(const void* cptr)
+  {
+    void* ptr = const_cast<void*>(cptr);
+    if (ptr == nullptr) {
+      return;
+    }
+
+    size_t k = 0;
+    if (!find_block_class(ptr, k)) {
+      fprintf(stderr, "Unknown pointer %p", ptr);
+      return;
+    }
+
+    if (k == num_size_classes) {
+      free_large(ptr);
+      return;
+    }
+
+    remove_used(get_block_size(k));
+
+    thread_cache& cache =
+        m_caches[detail::mempool_thread_index() % num_thread_caches];
+
+    lock_guard<std::mutex> lock(cache.mutex);
+    std::vector<void*>& blocks = cache.free_blocks[k];
+    blocks.push_back(ptr);
+    if (blocks.size() > 4 * cache_batch_size) {
+      // return the oldest blocks to the shared free list
+      size_class& shared = m_classes[k];
+      lock_guard<std::mutex> class_lock(shared.mutex);
+      shared.free_blocks.insert(shared.free_blocks.end(),
+                                blocks.begin(),
+                                blocks.begin() + 2 * cache_batch_size);
+      blocks.erase(blocks.begin(), blocks.begin() + 2 * cache_batch_size);
+    }
+  }
+
+  mempool_statistics statistics()
+  {
+    mempool_statistics stats;
+    stats.reserved_bytes = m_reserved_bytes.load();
+    stats.used_bytes = m_used_bytes.load();
+    stats.high_water_mark_bytes = m_high_water_mark_bytes.load();
+    stats.num_allocations = m_num_allocations.load();
+    return stats;
+  }
+
+private:
+  //! marks allocations passed to the allocator directly in the registry
+  static constexpr size_t large_class = num_size_classes;
+  //! number of independently locked parts of the block registry
+  static constexpr size_t num_registry_shards = 64;
+
+  struct size_class {
+    std::mutex mutex;
+    std::vector<void*> free_blocks;
+  };
+
+  struct thread_cache {
+    std::mutex mutex;
+    std::vector<void*> free_blocks[num_size_classes];
+  };
+
+  struct large_allocation {
+    void* allocation;
+    size_t size;
+  };
+
+  struct registry_shard {
+    std::mutex mutex;
+    std::unordered_map<void*, size_t> block_class;
+  };
+
+  static size_t get_block_size(size_t k) { return min_block_size << k; }
+
+  //! get the size class for a request, or large_class if it has none
+  static size_t get_size_class(size_t size, size_t alignment)
+  {
+    if (alignment > max_block_alignment) {
+      return large_class;
+    }
+    size_t k = 0;
+    while (k < num_size_classes && get_block_size(k) < size) {
+      ++k;
+    }
+    return k;
+  }
+
+  registry_shard& get_registry_shard(void* ptr)
+  {
+    size_t bits = reinterpret_cast<size_t>(ptr) / min_block_size;
+    return m_registry[(bits ^ (bits >> 6)) % num_registry_shards];
+  }
+
+  void register_block(void* ptr, size_t k)
+  {
+    registry_shard& shard = get_registry_shard(ptr);
+    lock_guard<std::mutex> lock(shard.mutex);
+    shard.block_class[ptr] = k;
+  }
+
+  bool find_block_class(void* ptr, size_t& k)
+  {
+    registry_shard& shard = get_registry_shard(ptr);
+    lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.block_class.find(ptr);
+    if (found == shard.block_class.end()) {
+      return false;
+    }
+    k = found->second;
+    return true;
+  }
+
+  void add_used(size_t nbytes)
+  {
+    m_num_allocations.fetch_add(1);
+    const size_t used = m_used_bytes.fetch_add(nbytes) + nbytes;
+    size_t high = m_high_water_mark_bytes.load();
+    while (used > high &&
+           !m_high_water_mark_bytes.compare_exchange_weak(high, used)) {
+    }
+  }
+
+  void remove_used(size_t nbytes)
+  {
+    m_num_allocations.fetch_sub(1);
+    m_used_bytes.fetch_sub(nbytes);
+  }
+
+  //! move up to cache_batch_size free blocks of class k into blocks
+  void refill(size_t k, std::vector<void*>& blocks)
+  {
+    size_class& shared = m_classes[k];
+    lock_guard<std::mutex> lock(shared.mutex);
+
+    if (shared.free_blocks.empty()) {
+      add_slab(k, shared.free_blocks);
+    }
+
+    const size_t num = std::min(shared.free_blocks.size(),
+                                static_cast<size_t>(cache_batch_size));
+    blocks.insert(blocks.end(),
+                  shared.free_blocks.end() - num,
+                  shared.free_blocks.end());
+    shared.free_blocks.erase(shared.free_blocks.end() - num,
+                             shared.free_blocks.end());
+  }
+
+  //! get a slab from the allocator and carve it into blocks of class k
+  void add_slab(size_t k, std::vector<void*>& free_blocks)
+  {
+    const size_t block_size = get_block_size(k);
+    const size_t alignment = std::min(block_size,
+                                      static_cast<size_t>(max_block_alignment));
+
+    void* slab_ptr = nullptr;
+    size_t slab_size = 0;
+    {
+      lock_guard<std::mutex> lock(m_mutex);
+
+      slab_size = std::max(block_size,
+                           std::min(m_default_arena_size / 16,
+                                    block_size * 1024));
+      slab_size += alignment;
+
+      slab_ptr = m_alloc.malloc(slab_size);
+      if (slab_ptr == nullptr) {
+        return;
+      }
+      m_slabs.push_back(slab_ptr);
+    }
+    m_reserved_bytes.fetch_add(slab_size);
+
+    void* block_ptr = slab_ptr;
+    size_t space = slab_size;
+    ::RAJA::align(alignment, block_size, block_ptr, space);
+
+    const size_t num_blocks = space / block_size;
+    free_blocks.reserve(free_blocks.size() + num_blocks);
+    for (size_t b = num_blocks; b > 0; --b) {
+      void* ptr = static_cast<char*>(block_ptr) + (b - 1) * block_size;
+      register_block(ptr, k);
+      free_blocks.push_back(ptr);
+    }
+  }
+
+  void* malloc_large(size_t size, size_t alignment)
+  {
+    const size_t alloc_size = size + alignment;
+
+    void* alloc_ptr = nullptr;
+    void* ptr = nullptr;
+    {
+      lock_guard<std::mutex> lock(m_mutex);
+
+      alloc_ptr = m_alloc.malloc(alloc_size);
+      if (alloc_ptr == nullptr) {
+        return nullptr;
+      }
+      ptr = alloc_ptr;
+      size_t space = alloc_size;
+      ::RAJA::align(alignment, size, ptr, space);
+      m_large[ptr] = large_allocation{alloc_ptr, alloc_size};
+    }
+
+    register_block(ptr, large_class);
+    m_reserved_bytes.fetch_add(alloc_size);
+    add_used(alloc_size);
+
+    return ptr;
+  }
+
+  void free_large(void* ptr)
+  {
+    {
+      registry_shard& shard = get_registry_shard(ptr);
+      lock_guard<std::mutex> lock(shard.mutex);
+      shard.block_class.erase(ptr);
+    }
+
+    lock_guard<std::mutex> lock(m_mutex);
+
+    auto found = m_large.find(ptr);
+    if (found != m_large.end()) {
+      const size_t alloc_size = found->second.size;
+      m_alloc.free(found->second.allocation);
+      m_large.erase(found);
+      m_reserved_bytes.fetch_sub(alloc_size);
+      remove_used(alloc_size);
+    }
+  }
+
+  std::mutex m_mutex;
+
+  std::vector<void*> m_slabs;
+  std::unordered_map<void*, large_allocation> m_large;
+
+  size_class m_classes[num_size_classes];
+  thread_cache m_caches[num_thread_caches];
+  registry_shard m_registry[num_registry_shards];
+
+  std::atomic<size_t> m_reserved_bytes{0};
+  std::atomic<size_t> m_used_bytes{0};
+  std::atomic<size_t> m_high_water_mark_bytes{0};
+  std::atomic<size_t> m_num_allocations{0};
+
+  size_t m_default_arena_size;
+  allocator_t m_alloc;
+};
+
+
 //! example allocator for basic_mempool using malloc/free
 struct generic_allocator {
 
@@ -21,6 +21,22 @@
 namespace RAJA {
 namespace util {
 
+/*!
+ * Whether any plugin is active. Kernel execution methods check this once
+ * and skip all plugin hooks when it is false. It is always false when
+ * RAJA is configured without plugin hooks.
+ */
+RAJA_INLINE
+bool
+plugins_active()
+{
+#if defined(RAJA_ENABLE_PLUGIN_HOOKS)
+  return detail::active_plugin_count.load(std::memory_order_relaxed) > 0;
+#else
+  return false;
+#endif
+}
+
 template <typename T>
 RAJA_INLINE auto trigger_updates_before(T&& item)
   -> typename std::remove_reference<T>::type
@@ -20,8 +20,16 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
@@ -29,6 +37,8 @@
 
 #include "RAJA/util/concepts.hpp"
 
+#include "RAJA/util/Operators.hpp"
+
 namespace RAJA
 {
 
@@ -693,6 +703,241 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief unsigned integer type with the given size in bytes used to hold
+    the radix sort representation of a key
+*/
+template <size_t num_bytes>
+struct radix_uint { using type = void; };
+///
+template <>
+struct radix_uint<1> { using type = std::uint8_t; };
+///
+template <>
+struct radix_uint<2> { using type = std::uint16_t; };
+///
+template <>
+struct radix_uint<4> { using type = std::uint32_t; };
+///
+template <>
+struct radix_uint<8> { using type = std::uint64_t; };
+
+/*!
+    \brief traits describing keys that radix sort can order, maps each key
+    to an unsigned integer whose unsigned ordering matches the key ordering
+*/
+template <typename T>
+struct radix_key
+{
+  using bits_type = typename radix_uint<sizeof(T)>::type;
+
+  static constexpr bool value =
+      !std::is_same<bits_type, void>::value &&
+      (std::is_integral<T>::value ||
+       (std::is_floating_point<T>::value &&
+        std::numeric_limits<T>::is_iec559));
+
+  static bits_type to_bits(T key)
+  {
+    return to_bits(key, std::is_integral<T>{});
+  }
+
+private:
+  static constexpr bits_type sign_bit()
+  {
+    return static_cast<bits_type>(bits_type(1) << (8*sizeof(bits_type) - 1));
+  }
+
+  // integers, flip the sign bit so negative values order first
+  static bits_type to_bits(T key, std::true_type)
+  {
+    bits_type u = static_cast<bits_type>(key);
+    if (std::is_signed<T>::value) {
+      u = static_cast<bits_type>(u ^ sign_bit());
+    }
+    return u;
+  }
+
+  // floating point, flip all bits of negative values and the sign bit of
+  // positive values, -0.0 is folded into +0.0 so equal keys stay equal
+  static bits_type to_bits(T key, std::false_type)
+  {
+    if (key == T(0)) {
+      key = T(0);
+    }
+    bits_type u;
+    std::memcpy(&u, &key, sizeof(bits_type));
+    return (u & sign_bit()) ? static_cast<bits_type>(~u)
+                            : static_cast<bits_type>(u | sign_bit());
+  }
+};
+
+/*!
+    \brief true if Compare orders the keys in descending order
+*/
+template <typename Compare>
+struct radix_descending : std::false_type {};
+///
+template <typename T>
+struct radix_descending<operators::greater<T>> : std::true_type {};
+
+/*!
+    \brief true if the range given by Iter can be radix sorted using Compare,
+    requires contiguous arithmetic keys and a less or greater comparator
+*/
+template <typename Iter, typename Compare,
+          typename T = typename std::iterator_traits<Iter>::value_type>
+struct is_radix_sortable
+    : std::integral_constant<bool,
+          std::is_pointer<Iter>::value &&
+          radix_key<T>::value &&
+          (std::is_same<Compare, operators::less<T>>::value ||
+           std::is_same<Compare, operators::greater<T>>::value)>
+{ };
+
+/*!
+    \brief true if the range of pairs given by KeyIter and ValIter can be
+    radix sorted using Compare, values must be contiguous and trivially
+    copyable
+*/
+template <typename KeyIter, typename ValIter, typename Compare>
+struct is_radix_sortable_pairs
+    : std::integral_constant<bool,
+          is_radix_sortable<KeyIter, Compare>::value &&
+          std::is_pointer<ValIter>::value &&
+          std::is_trivially_copyable<
+              typename std::iterator_traits<ValIter>::value_type>::value>
+{ };
+
+/*!
+    \brief placeholder value type used when radix sorting keys only
+*/
+struct radix_no_value { };
+
+/*!
+    \brief number of bits in each radix sort digit
+*/
+constexpr size_t radix_digit_bits = 8;
+
+/*!
+    \brief number of buckets for each radix sort digit
+*/
+constexpr size_t radix_num_buckets = size_t(1) << radix_digit_bits;
+
+/*!
+    \brief below this length radix sort falls back to comparison sorting
+*/
+constexpr size_t radix_sort_cutoff = 256;
+
+/*!
+    \brief get the radix sort digit of key bits u for the given pass
+*/
+template <typename U>
+RAJA_INLINE
+size_t radix_digit(U u, size_t pass)
+{
+  return static_cast<size_t>(u >> (pass * radix_digit_bits)) &
+         (radix_num_buckets - 1);
+}
+
+/*!
+    \brief get the radix sort bits of key for the given comparator
+*/
+template <typename Compare, typename Key>
+RAJA_INLINE
+typename radix_key<Key>::bits_type radix_bits(Key key)
+{
+  using bits_type = typename radix_key<Key>::bits_type;
+  bits_type u = radix_key<Key>::to_bits(key);
+  return radix_descending<Compare>::value ? static_cast<bits_type>(~u) : u;
+}
+
+/*!
+    \brief allocate an uninitialized buffer for n radix sort elements
+*/
+template <typename T>
+RAJA_INLINE
+T* radix_allocate(size_t n)
+{
+  T* ptr = RAJA::allocate_aligned_type<T>(RAJA::DATA_ALIGN, n * sizeof(T));
+  if (ptr == nullptr) {
+    RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+  }
+  return ptr;
+}
+
+/*!
+    \brief stable least significant digit radix sort of keys inplace and
+    values alongside the keys if vals is not null, uses O(N) memory and
+    skips passes whose digit is the same for every key
+*/
+template <typename Compare, typename Key, typename Val>
+RAJA_INLINE
+void radix_sort(Key* keys, Val* vals, size_t len)
+{
+  using bits_type = typename radix_key<Key>::bits_type;
+  constexpr size_t num_passes = sizeof(bits_type);
+
+  if (len < 2) {
+    return;
+  }
+
+  const bool has_vals = (vals != nullptr);
+
+  // histogram every digit in a single read of the keys
+  size_t counts[num_passes][radix_num_buckets] = {};
+  for (size_t i = 0; i < len; ++i) {
+    bits_type u = radix_bits<Compare>(keys[i]);
+    for (size_t pass = 0; pass < num_passes; ++pass) {
+      ++counts[pass][radix_digit(u, pass)];
+    }
+  }
+
+  std::unique_ptr<Key, FreeAligned> key_buf(radix_allocate<Key>(len));
+  std::unique_ptr<Val, FreeAligned> val_buf(
+      has_vals ? radix_allocate<Val>(len) : nullptr);
+
+  Key* src_keys = keys;
+  Val* src_vals = vals;
+  Key* dst_keys = key_buf.get();
+  Val* dst_vals = val_buf.get();
+
+  for (size_t pass = 0; pass < num_passes; ++pass) {
+
+    size_t* offsets = counts[pass];
+
+    // every key has the same digit, the scatter would be a copy
+    if (offsets[radix_digit(radix_bits<Compare>(src_keys[0]), pass)] == len) {
+      continue;
+    }
+
+    size_t sum = 0;
+    for (size_t b = 0; b < radix_num_buckets; ++b) {
+      size_t count = offsets[b];
+      offsets[b] = sum;
+      sum += count;
+    }
+
+    for (size_t i = 0; i < len; ++i) {
+      size_t dst = offsets[radix_digit(radix_bits<Compare>(src_keys[i]), pass)]++;
+      dst_keys[dst] = src_keys[i];
+      if (has_vals) {
+        dst_vals[dst] = src_vals[i];
+      }
+    }
+
+    std::swap(src_keys, dst_keys);
+    std::swap(src_vals, dst_vals);
+  }
+
+  if (src_keys != keys) {
+    std::copy(src_keys, src_keys + len, keys);
+    if (has_vals) {
+      std::copy(src_vals, src_vals + len, vals);
+    }
+  }
+}
+
 }  // namespace detail
 
 /*!
@@ -163,6 +163,11 @@ using Index_type = std::ptrdiff_t;
 ///
 const int UndefinedValue = -9999999;
 
+///
+/// Assumed size of a cache line, used to pad data shared between threads.
+///
+constexpr std::size_t cache_line_size = 64;
+
 
 ///
 /// Template list of sizes
@@ -0,0 +1,282 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/ChromeTracePlugin.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace RAJA {
+namespace util {
+
+namespace {
+
+constexpr size_t default_events_per_thread = 65536;
+
+std::atomic<uint64_t> s_next_plugin_id{1};
+
+const char* platform_name(int platform)
+{
+  switch (static_cast<Platform>(platform)) {
+    case Platform::host:       return "host";
+    case Platform::cuda:       return "cuda";
+    case Platform::hip:        return "hip";
+    case Platform::sycl:       return "sycl";
+    case Platform::omp_target: return "omp_target";
+    default:                   return "undefined";
+  }
+}
+
+void write_escaped(FILE* out, const char* str)
+{
+  for (; *str != '\0'; ++str) {
+    const unsigned char c = static_cast<unsigned char>(*str);
+    if (c == '"' || c == '\\') {
+      std::fputc('\\', out);
+      std::fputc(c, out);
+    } else if (c < 0x20) {
+      std::fprintf(out, "\\u%04x", static_cast<unsigned>(c));
+    } else {
+      std::fputc(c, out);
+    }
+  }
+}
+
+}  // end anonymous namespace
+
+/*!
+ * Events of one thread. Only the owning thread records into a buffer; the
+ * mutex guards events and count against write(), so it is only contended
+ * while the trace is written.
+ */
+struct ChromeTracePlugin::ThreadBuffer
+{
+  ThreadBuffer(size_t capacity, int tid_in)
+    : events(capacity), tid(tid_in)
+  {
+    open.reserve(16);
+  }
+
+  //! copy of kernel_name that stays valid for write(), reusing the copy
+  //! last used at call_site_id if the name is the same
+  const std::string* internName(uint64_t call_site_id, const char* kernel_name)
+  {
+    auto last = last_names.find(call_site_id);
+    if (last != last_names.end() && *last->second == kernel_name) {
+      return last->second;
+    }
+    const std::string* name = &*names.emplace(kernel_name).first;
+    last_names[call_site_id] = name;
+    return name;
+  }
+
+  std::vector<Event> events;
+  uint64_t count = 0;
+  std::mutex mutex;
+
+  struct OpenKernel
+  {
+    uint64_t begin_ns;
+    const std::string* kernel_name;
+  };
+
+  //! kernels running on this thread, innermost last
+  std::vector<OpenKernel> open;
+
+  //! copies of the kernel names seen on this thread, set elements do not
+  //! move so events can point to them, and the name last used by each
+  //! call site
+  std::unordered_set<std::string> names;
+  std::unordered_map<uint64_t, const std::string*> last_names;
+
+  int tid;
+};
+
+ChromeTracePlugin::ChromeTracePlugin()
+  : Parent(false),
+    m_capacity(default_events_per_thread),
+    m_start(std::chrono::steady_clock::now()),
+    m_id(s_next_plugin_id.fetch_add(1, std::memory_order_relaxed))
+{
+  const char* path = ::getenv("RAJA_CHROME_TRACE");
+  if (nullptr == path || '\0' == path[0]) {
+    return;
+  }
+  m_path = path;
+
+  const char* events = ::getenv("RAJA_CHROME_TRACE_EVENTS");
+  if (nullptr != events) {
+    const long long capacity = std::atoll(events);
+    if (capacity > 0) {
+      m_capacity = static_cast<size_t>(capacity);
+    } else {
+      printf("[ChromeTracePlugin]: ignoring RAJA_CHROME_TRACE_EVENTS=%s\n",
+             events);
+    }
+  }
+
+  setActive(true);
+}
+
+ChromeTracePlugin::~ChromeTracePlugin()
+{
+  if (!m_path.empty() && !m_written) {
+    write(m_path);
+  }
+}
+
+ChromeTracePlugin::ThreadBuffer* ChromeTracePlugin::getThreadBuffer()
+{
+  struct Cache
+  {
+    uint64_t id;
+    ThreadBuffer* buffer;
+  };
+  static thread_local Cache cache{0, nullptr};
+
+  if (cache.id != m_id) {
+    std::lock_guard<std::mutex> lock(m_buffers_mutex);
+    m_buffers.emplace_back(
+        new ThreadBuffer(m_capacity, static_cast<int>(m_buffers.size())));
+    cache.id = m_id;
+    cache.buffer = m_buffers.back().get();
+  }
+  return cache.buffer;
+}
+
+void ChromeTracePlugin::preLaunch(const RAJA::util::PluginContext& p)
+{
+  // hooks are called while other plugins are active
+  if (m_path.empty()) {
+    return;
+  }
+
+  ThreadBuffer* buffer = getThreadBuffer();
+
+  const std::string* name =
+      nullptr != p.kernel_name
+          ? buffer->internName(p.call_site_id, p.kernel_name)
+          : nullptr;
+
+  buffer->open.push_back(ThreadBuffer::OpenKernel{now(), name});
+}
+
+void ChromeTracePlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (m_path.empty()) {
+    return;
+  }
+
+  const uint64_t end = now();
+
+  ThreadBuffer* buffer = getThreadBuffer();
+  if (buffer->open.empty()) {
+    return;
+  }
+  const ThreadBuffer::OpenKernel kernel = buffer->open.back();
+  buffer->open.pop_back();
+
+  std::lock_guard<std::mutex> lock(buffer->mutex);
+  Event& e = buffer->events[buffer->count % buffer->events.size()];
+  e.begin_ns = kernel.begin_ns;
+  e.end_ns = end;
+  e.call_site_id = p.call_site_id;
+  e.num_iterations = p.num_iterations;
+  e.policy_name = p.policy_name;
+  e.kernel_name = kernel.kernel_name;
+  e.platform = static_cast<int>(p.platform);
+  ++buffer->count;
+}
+
+void ChromeTracePlugin::finalize()
+{
+  if (!m_path.empty() && !m_written) {
+    m_written = write(m_path);
+  }
+  setActive(false);
+}
+
+bool ChromeTracePlugin::write(const std::string& path) const
+{
+  FILE* out = std::fopen(path.c_str(), "w");
+  if (nullptr == out) {
+    perror("[ChromeTracePlugin]: Could not open trace file");
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(m_buffers_mutex);
+
+  uint64_t dropped = 0;
+  bool first = true;
+  std::vector<Event> events;
+  std::fprintf(out, "{\"traceEvents\":[\n");
+
+  for (auto const& buffer : m_buffers) {
+    std::fprintf(out,
+                 "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                 "\"tid\":%d,\"args\":{\"name\":\"RAJA thread %d\"}}",
+                 first ? "" : ",\n", buffer->tid, buffer->tid);
+    first = false;
+
+    // copy the events, so the owning thread waits only for the copy
+    uint64_t count = 0;
+    {
+      std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+      events = buffer->events;
+      count = buffer->count;
+    }
+    const uint64_t capacity = events.size();
+    const uint64_t begin = count > capacity ? count - capacity : 0;
+    dropped += begin;
+
+    for (uint64_t i = begin; i < count; ++i) {
+      Event const& e = events[i % capacity];
+
+      const char* kernel_name = nullptr != e.kernel_name
+                                    ? e.kernel_name->c_str()
+                                    : e.policy_name;
+
+      std::fprintf(out, ",\n{\"name\":\"");
+      write_escaped(out, kernel_name);
+      std::fprintf(out, "\",\"cat\":\"");
+      write_escaped(out, e.policy_name);
+      std::fprintf(out,
+                   "\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,"
+                   "\"ts\":%.3f,\"dur\":%.3f,"
+                   "\"args\":{\"platform\":\"%s\",\"iterations\":%llu,"
+                   "\"call_site\":\"%016llx\"}}",
+                   buffer->tid,
+                   static_cast<double>(e.begin_ns) * 1.0e-3,
+                   static_cast<double>(e.end_ns - e.begin_ns) * 1.0e-3,
+                   platform_name(e.platform),
+                   static_cast<unsigned long long>(e.num_iterations),
+                   static_cast<unsigned long long>(e.call_site_id));
+    }
+  }
+
+  std::fprintf(out,
+               "\n],\"displayTimeUnit\":\"ns\","
+               "\"otherData\":{\"dropped_events\":%llu}}\n",
+               static_cast<unsigned long long>(dropped));
+
+  if (dropped > 0) {
+    printf("[ChromeTracePlugin]: dropped %llu oldest events, "
+           "increase RAJA_CHROME_TRACE_EVENTS to keep them\n",
+           static_cast<unsigned long long>(dropped));
+  }
+
+  return std::fclose(out) == 0;
+}
+
+void linkChromeTracePlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::ChromeTracePlugin> P("ChromeTracePlugin", "Write a Chrome trace of RAJA kernels to RAJA_CHROME_TRACE.");
@@ -42,7 +42,7 @@ getFunction(void* plugin, std::vector<function>& functions, const char* fname)
 namespace RAJA {
 namespace util {
 
-KokkosPluginLoader::KokkosPluginLoader()
+KokkosPluginLoader::KokkosPluginLoader() : Parent(false)
 {
   char *env = getenv("KOKKOS_PLUGINS");
   if (env == nullptr)
@@ -50,6 +50,7 @@ KokkosPluginLoader::KokkosPluginLoader()
     return;
   }
   initDirectory(std::string(env));
+  setActive(!pre_functions.empty() || !post_functions.empty());
 
   for (auto &func : init_functions)
   {
@@ -61,7 +62,7 @@ void KokkosPluginLoader::preLaunch(const RAJA::util::PluginContext& p)
 {
   for (auto &func : pre_functions)
   {
-    func("", 0, &(p.kID));
+    func(p.kernel_name != nullptr ? p.kernel_name : p.policy_name, 0, &(p.kID));
   }
 }
 
@@ -83,6 +84,7 @@ void KokkosPluginLoader::finalize()
   pre_functions.clear();
   post_functions.clear();
   finalize_functions.clear();
+  setActive(false);
 }
 
 // Initialize plugin from a shared object file specified by 'path'.
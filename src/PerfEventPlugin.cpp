@@ -0,0 +1,410 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/util/PerfEventPlugin.hpp"
+
+#include "RAJA/config.hpp"
+#include "RAJA/util/macros.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+namespace RAJA {
+namespace util {
+
+namespace {
+
+struct CounterInfo
+{
+  const char* name;
+  uint32_t type;
+  uint64_t config;
+};
+
+#if defined(__linux__)
+const CounterInfo counter_info[PerfEventPlugin::num_counters] = {
+    {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"llc_misses",
+     PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+    {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+
+int perf_event_open(uint32_t type, uint64_t config, int group_fd)
+{
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+  // counters of the calling thread on any cpu
+  return static_cast<int>(
+      syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+#else
+const CounterInfo counter_info[PerfEventPlugin::num_counters] = {
+    {"cycles", 0, 0},
+    {"instructions", 0, 0},
+    {"llc_misses", 0, 0},
+    {"branch_misses", 0, 0}};
+#endif
+
+}  // end anonymous namespace
+
+PerfEventPlugin::PerfEventPlugin() : Parent(false)
+{
+  const char* env = ::getenv("RAJA_PERF_EVENTS");
+  if (nullptr == env) {
+    return;
+  }
+  if ('\0' != env[0] && 0 != std::strcmp(env, "1")) {
+    m_csv_path = env;
+  }
+
+#if defined(__linux__)
+  m_disabled.store(false, std::memory_order_relaxed);
+  setActive(true);
+#else
+  printf("[PerfEventPlugin]: perf_event counters are only available on "
+         "Linux, counters disabled\n");
+#endif
+}
+
+PerfEventPlugin::~PerfEventPlugin()
+{
+  closeCounters();
+}
+
+bool PerfEventPlugin::openThreadCounters(ThreadCounters& thread)
+{
+#if defined(__linux__)
+  for (int c = 0; c < num_counters; ++c) {
+    if (!m_available[c]) {
+      continue;
+    }
+    const int fd = perf_event_open(counter_info[c].type,
+                                   counter_info[c].config,
+                                   thread.leader_fd);
+    if (fd < 0) {
+      return false;
+    }
+    if (thread.leader_fd < 0) {
+      thread.leader_fd = fd;
+    }
+    thread.fds.push_back(fd);
+  }
+  ioctl(thread.leader_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(thread.leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  return true;
+#else
+  RAJA_UNUSED_ARG(thread);
+  return false;
+#endif
+}
+
+// Open the counters of every OpenMP thread. The counters of the calling
+// thread are opened first to find out which counters the machine has.
+bool PerfEventPlugin::openCounters()
+{
+#if defined(__linux__)
+  if (m_threads.empty()) {
+    ThreadCounters master;
+    for (int c = 0; c < num_counters; ++c) {
+      const int fd = perf_event_open(counter_info[c].type,
+                                     counter_info[c].config,
+                                     master.leader_fd);
+      if (fd < 0) {
+        printf("[PerfEventPlugin]: %s counter unavailable: %s\n",
+               counter_info[c].name,
+               std::strerror(errno));
+        continue;
+      }
+      m_available[c] = true;
+      if (master.leader_fd < 0) {
+        master.leader_fd = fd;
+      }
+      master.fds.push_back(fd);
+    }
+    if (master.leader_fd < 0) {
+      printf("[PerfEventPlugin]: no counters available, "
+             "check /proc/sys/kernel/perf_event_paranoid\n");
+      return false;
+    }
+    ioctl(master.leader_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(master.leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    m_threads.push_back(master);
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  const int num_threads = omp_get_max_threads();
+  if (static_cast<size_t>(num_threads) > m_threads.size()) {
+    const size_t first_new = m_threads.size();
+    m_threads.resize(num_threads);
+    bool opened = true;
+#pragma omp parallel num_threads(num_threads) reduction(&& : opened)
+    {
+      const size_t t = static_cast<size_t>(omp_get_thread_num());
+      if (t >= first_new) {
+        opened = openThreadCounters(m_threads[t]);
+      }
+    }
+    if (!opened) {
+      printf("[PerfEventPlugin]: could not open counters on all OpenMP "
+             "threads, counts only include some threads\n");
+    }
+  }
+#endif
+
+  return true;
+#else
+  return false;
+#endif
+}
+
+// Sum the counts of all threads, scaled for multiplexing by the kernel.
+void PerfEventPlugin::readCounters(uint64_t* counts) const
+{
+  for (int c = 0; c < num_counters; ++c) {
+    counts[c] = 0;
+  }
+#if defined(__linux__)
+  uint64_t values[3 + num_counters];
+  for (ThreadCounters const& thread : m_threads) {
+    if (thread.leader_fd < 0) {
+      continue;
+    }
+    const ssize_t bytes = ::read(thread.leader_fd, values, sizeof(values));
+    if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t))) {
+      continue;
+    }
+    const uint64_t nr = values[0];
+    const double enabled = static_cast<double>(values[1]);
+    const double running = static_cast<double>(values[2]);
+    const double scale = running > 0.0 ? enabled / running : 0.0;
+    uint64_t i = 0;
+    for (int c = 0; c < num_counters && i < nr; ++c) {
+      if (m_available[c]) {
+        counts[c] += static_cast<uint64_t>(
+            static_cast<double>(values[3 + i]) * scale);
+        ++i;
+      }
+    }
+  }
+#endif
+}
+
+void PerfEventPlugin::closeCounters()
+{
+#if defined(__linux__)
+  for (ThreadCounters& thread : m_threads) {
+    for (int fd : thread.fds) {
+      ::close(fd);
+    }
+  }
+#endif
+  m_threads.clear();
+}
+
+void PerfEventPlugin::preLaunch(const RAJA::util::PluginContext&)
+{
+  // hooks are called while other plugins are active
+  if (m_disabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+#if defined(RAJA_ENABLE_OPENMP)
+  if (omp_in_parallel()) {
+    return;
+  }
+#endif
+  const std::thread::id self = std::this_thread::get_id();
+  std::thread::id owner;
+  if (!m_owner.compare_exchange_strong(owner, self) && owner != self) {
+    return;
+  }
+
+  if (m_depth++ > 0) {
+    return;
+  }
+
+  if (!openCounters()) {
+    m_disabled.store(true, std::memory_order_relaxed);
+    setActive(false);
+    return;
+  }
+
+  readCounters(m_begin);
+}
+
+void PerfEventPlugin::postLaunch(const RAJA::util::PluginContext& p)
+{
+  if (m_disabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+#if defined(RAJA_ENABLE_OPENMP)
+  if (omp_in_parallel()) {
+    return;
+  }
+#endif
+  if (m_owner.load() != std::this_thread::get_id() || m_depth == 0) {
+    return;
+  }
+  if (--m_depth > 0) {
+    return;
+  }
+
+  uint64_t end[num_counters];
+  readCounters(end);
+
+  size_t index;
+  auto call_site = m_call_sites.find(p.call_site_id);
+  if (p.call_site_id != 0 && call_site != m_call_sites.end()) {
+    index = call_site->second;
+  } else {
+    const std::string name =
+        nullptr != p.kernel_name ? p.kernel_name : p.policy_name;
+    auto named = m_names.find(name);
+    if (named != m_names.end()) {
+      index = named->second;
+    } else {
+      index = m_kernels.size();
+      m_kernels.emplace_back();
+      m_kernels.back().name = name;
+      m_names.emplace(name, index);
+    }
+    if (p.call_site_id != 0) {
+      m_call_sites.emplace(p.call_site_id, index);
+    }
+  }
+
+  KernelCounters& kernel = m_kernels[index];
+  ++kernel.launches;
+  for (int c = 0; c < num_counters; ++c) {
+    kernel.counts[c] += end[c] > m_begin[c] ? end[c] - m_begin[c] : 0;
+  }
+}
+
+void PerfEventPlugin::finalize()
+{
+  if (!m_kernels.empty()) {
+    printSummary();
+    if (!m_csv_path.empty()) {
+      writeCSV(m_csv_path);
+    }
+  }
+  closeCounters();
+  m_kernels.clear();
+  m_call_sites.clear();
+  m_names.clear();
+  m_disabled.store(true, std::memory_order_relaxed);
+  setActive(false);
+}
+
+void PerfEventPlugin::printSummary() const
+{
+  std::vector<const KernelCounters*> sorted;
+  for (KernelCounters const& kernel : m_kernels) {
+    sorted.push_back(&kernel);
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const KernelCounters* a, const KernelCounters* b) {
+              return a->counts[0] > b->counts[0];
+            });
+
+  printf("[PerfEventPlugin]: hardware counters by kernel\n");
+  printf("%-40s %10s", "kernel", "launches");
+  for (int c = 0; c < num_counters; ++c) {
+    printf(" %16s", counter_info[c].name);
+  }
+  printf(" %8s\n", "ipc");
+
+  for (const KernelCounters* kernel : sorted) {
+    std::string name = kernel->name;
+    if (name.size() > 40) {
+      name = name.substr(0, 37) + "...";
+    }
+    printf("%-40s %10llu", name.c_str(),
+           static_cast<unsigned long long>(kernel->launches));
+    for (int c = 0; c < num_counters; ++c) {
+      if (m_available[c]) {
+        printf(" %16llu", static_cast<unsigned long long>(kernel->counts[c]));
+      } else {
+        printf(" %16s", "n/a");
+      }
+    }
+    if (m_available[0] && m_available[1] && kernel->counts[0] > 0) {
+      printf(" %8.3f\n", static_cast<double>(kernel->counts[1]) /
+                             static_cast<double>(kernel->counts[0]));
+    } else {
+      printf(" %8s\n", "n/a");
+    }
+  }
+}
+
+bool PerfEventPlugin::writeCSV(const std::string& path) const
+{
+  FILE* out = std::fopen(path.c_str(), "w");
+  if (nullptr == out) {
+    perror("[PerfEventPlugin]: Could not open CSV file");
+    return false;
+  }
+
+  std::fprintf(out, "kernel,launches");
+  for (int c = 0; c < num_counters; ++c) {
+    std::fprintf(out, ",%s", counter_info[c].name);
+  }
+  std::fprintf(out, "\n");
+
+  for (KernelCounters const& kernel : m_kernels) {
+    // quote the name, policy names contain commas
+    std::fputc('"', out);
+    for (char ch : kernel.name) {
+      if (ch == '"') {
+        std::fputc('"', out);
+      }
+      std::fputc(ch, out);
+    }
+    std::fprintf(out, "\",%llu",
+                 static_cast<unsigned long long>(kernel.launches));
+    for (int c = 0; c < num_counters; ++c) {
+      if (m_available[c]) {
+        std::fprintf(out, ",%llu",
+                     static_cast<unsigned long long>(kernel.counts[c]));
+      } else {
+        std::fprintf(out, ",");
+      }
+    }
+    std::fprintf(out, "\n");
+  }
+
+  return std::fclose(out) == 0;
+}
+
+void linkPerfEventPlugin() {}
+
+} // end namespace util
+} // end namespace RAJA
+
+static RAJA::util::PluginRegistry::add<RAJA::util::PerfEventPlugin> P("PerfEventPlugin", "Count hardware events by kernel when RAJA_PERF_EVENTS is set.");
@@ -12,7 +12,32 @@ RAJA_INSTANTIATE_REGISTRY(PluginRegistry);
 namespace RAJA {
 namespace util {
 
-PluginStrategy::PluginStrategy() = default;
+namespace detail {
+
+std::atomic<int> active_plugin_count{0};
+
+}
+
+PluginStrategy::PluginStrategy() : PluginStrategy(true) { }
+
+PluginStrategy::PluginStrategy(bool active)
+{
+  setActive(active);
+}
+
+PluginStrategy::~PluginStrategy()
+{
+  setActive(false);
+}
+
+void PluginStrategy::setActive(bool active)
+{
+  if (active != m_active) {
+    m_active = active;
+    detail::active_plugin_count.fetch_add(active ? 1 : -1,
+                                          std::memory_order_relaxed);
+  }
+}
 
 void PluginStrategy::init(const PluginOptions&) { }
 
@@ -22,7 +22,8 @@ isSharedObject(const std::string& filename)
 namespace RAJA {
 namespace util {
   
-RuntimePluginLoader::RuntimePluginLoader()
+// plugins loaded here are active on their own, so the loader is not
+RuntimePluginLoader::RuntimePluginLoader() : Parent(false)
 {
   char *env = ::getenv("RAJA_PLUGINS");
   if (nullptr == env)
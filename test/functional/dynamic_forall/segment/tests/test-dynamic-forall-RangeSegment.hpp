@@ -69,6 +69,63 @@ void DynamicForallRangeSegmentTestImpl(INDEX_TYPE first, INDEX_TYPE last, const
                                        test_array);
 }
 
+template <typename INDEX_TYPE, typename WORKING_RES, typename POLICY_LIST>
+void DynamicForallRangeSegmentAutoTestImpl(INDEX_TYPE first, INDEX_TYPE last)
+{
+  constexpr int N = camp::size<POLICY_LIST>::value;
+
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(RAJA::stripIndexType(first), RAJA::stripIndexType(last));
+  INDEX_TYPE len = static_cast<INDEX_TYPE>(r1.end() - r1.begin());
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  INDEX_TYPE* working_array;
+  INDEX_TYPE* check_array;
+  INDEX_TYPE* test_array;
+
+  size_t data_len = RAJA::stripIndexType(len);
+
+  allocateForallTestData<INDEX_TYPE>(data_len,
+                                     working_res,
+                                     &working_array,
+                                     &check_array,
+                                     &test_array);
+
+  const INDEX_TYPE rbegin = *r1.begin();
+
+  std::iota(test_array, test_array + data_len, rbegin);
+
+  auto body = [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    working_array[RAJA::stripIndexType(idx - rbegin)] = idx;
+  };
+
+  // enough runs to time every policy and pin one
+  const int runs = N * RAJA::expt::dynamic_tuning_options().probe_samples + 2;
+
+  for (int run = 0; run < runs; ++run) {
+
+    memset(static_cast<void*>(working_array), 0, sizeof(INDEX_TYPE) * data_len);
+
+    RAJA::expt::dynamic_forall<POLICY_LIST>(RAJA::expt::dynamic_auto, r1, body);
+
+    working_res.memcpy(check_array, working_array, sizeof(INDEX_TYPE) * data_len);
+
+    for (INDEX_TYPE i = INDEX_TYPE(0); i < len; i++) {
+      ASSERT_EQ(test_array[RAJA::stripIndexType(i)], check_array[RAJA::stripIndexType(i)]);
+    }
+  }
+
+  auto& bucket = RAJA::expt::detail::dynamic_tuning_table<N, POLICY_LIST, decltype(body)>()
+      .buckets[RAJA::expt::detail::dynamic_tuning_bucket(data_len)];
+  const int best = bucket.best.load();
+  ASSERT_GE(best, 0);
+  ASSERT_LT(best, N);
+
+  deallocateForallTestData<INDEX_TYPE>(working_res,
+                                       working_array,
+                                       check_array,
+                                       test_array);
+}
+
 
 TYPED_TEST_SUITE_P(DynamicForallRangeSegmentTest);
 template <typename T>
@@ -123,9 +180,28 @@ TYPED_TEST_P(DynamicForallRangeSegmentTest, RangeSegmentForall)
 #endif
 
 
+}
+
+TYPED_TEST_P(DynamicForallRangeSegmentTest, RangeSegmentForallAuto)
+{
+
+  //Auto mode tries every policy in the list, so it can only be tested
+  //when all of them run on the host
+#if !defined(RAJA_GPU_ACTIVE)
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using POLICY_LIST = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  DynamicForallRangeSegmentAutoTestImpl<INDEX_TYPE, WORKING_RES, POLICY_LIST>
+    (INDEX_TYPE(0), INDEX_TYPE(27));
+  DynamicForallRangeSegmentAutoTestImpl<INDEX_TYPE, WORKING_RES, POLICY_LIST>
+    (INDEX_TYPE(3), INDEX_TYPE(2057));
+#endif
+
 }
 
 REGISTER_TYPED_TEST_SUITE_P(DynamicForallRangeSegmentTest,
-                            RangeSegmentForall);
+                            RangeSegmentForall,
+                            RangeSegmentForallAuto);
 
 #endif  // __TEST_BASIC_SHARED_HPP__
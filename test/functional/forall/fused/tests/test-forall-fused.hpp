@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_FUSED_HPP__
+#define __TEST_FORALL_FUSED_HPP__
+
+#include <algorithm>
+
+template <typename INDEX_TYPE, typename WORKING_RES, typename EXEC_POLICY>
+void ForallFusedTestImpl(INDEX_TYPE N, RAJA::Index_type strip)
+{
+  RAJA::TypedRangeSegment<INDEX_TYPE> r1(0, N);
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  double* a_array;
+  double* b_array;
+  double* c_array;
+  double* check_array;
+  double* test_array;
+
+  size_t data_len = RAJA::stripIndexType(N);
+
+  allocateForallTestData<double>(data_len,
+                                 working_res,
+                                 &c_array,
+                                 &check_array,
+                                 &test_array);
+
+  a_array = working_res.allocate<double>(data_len);
+  b_array = working_res.allocate<double>(data_len);
+
+  double b_sum = 0.0;
+  double c_sum = 0.0;
+  double c_max = -1.0;
+
+  auto body1 = [=] RAJA_HOST_DEVICE(INDEX_TYPE idx) {
+    a_array[idx] = static_cast<double>(idx % 17);
+  };
+
+  auto body2 = RAJA::fused_body(
+    RAJA::expt::Reduce<RAJA::operators::plus>(&b_sum),
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx, double& s) {
+      b_array[idx] = 2.0 * a_array[idx];
+      s += b_array[idx];
+    });
+
+  auto body3 = RAJA::fused_body(
+    RAJA::expt::Reduce<RAJA::operators::plus>(&c_sum),
+    RAJA::expt::Reduce<RAJA::operators::maximum>(&c_max),
+    [=] RAJA_HOST_DEVICE(INDEX_TYPE idx, double& s, double& m) {
+      c_array[idx] = a_array[idx] + b_array[idx];
+      s += c_array[idx];
+      m = m > c_array[idx] ? m : c_array[idx];
+    });
+
+  if (strip > 0) {
+    RAJA::forall_fused<EXEC_POLICY>(r1, RAJA::strip_mine(strip),
+                                    body1, body2, body3);
+  } else {
+    RAJA::forall_fused<EXEC_POLICY>(r1, body1, body2, body3);
+  }
+
+  double ref_b_sum = 0.0;
+  double ref_c_max = -1.0;
+  for (size_t i = 0; i < data_len; ++i) {
+    test_array[i] = 3.0 * static_cast<double>(i % 17);
+    ref_b_sum += 2.0 * static_cast<double>(i % 17);
+    ref_c_max = std::max(ref_c_max, test_array[i]);
+  }
+
+  working_res.memcpy(check_array, c_array, sizeof(double) * data_len);
+
+  for (size_t i = 0; i < data_len; ++i) {
+    ASSERT_EQ(test_array[i], check_array[i]);
+  }
+  ASSERT_EQ(b_sum, ref_b_sum);
+  ASSERT_EQ(c_sum, 1.5 * ref_b_sum);
+  ASSERT_EQ(c_max, ref_c_max);
+
+  working_res.deallocate(a_array);
+  working_res.deallocate(b_array);
+  deallocateForallTestData<double>(working_res,
+                                   c_array,
+                                   check_array,
+                                   test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallFusedTest);
+template <typename T>
+class ForallFusedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallFusedTest, FusedForall)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(37), 0);
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(2057), 0);
+}
+
+TYPED_TEST_P(ForallFusedTest, FusedForallStripMined)
+{
+  using INDEX_TYPE  = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<1>>::type;
+  using EXEC_POLICY = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(37), 64);
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(2057), 64);
+  ForallFusedTestImpl<INDEX_TYPE, WORKING_RES, EXEC_POLICY>(INDEX_TYPE(2057), 1);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallFusedTest,
+                            FusedForall,
+                            FusedForallStripMined);
+
+#endif  // __TEST_FORALL_FUSED_HPP__
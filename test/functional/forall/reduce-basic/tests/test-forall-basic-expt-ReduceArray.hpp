@@ -0,0 +1,172 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BASIC_REDUCEARRAY_HPP__
+#define __TEST_FORALL_BASIC_REDUCEARRAY_HPP__
+
+#include <cstdlib>
+#include <ctime>
+#include <numeric>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceArrayBasicTestImpl(const SEG_TYPE& seg,
+                                    const std::vector<IDX_TYPE>& seg_idx,
+                                    int num_bins,
+                                    camp::resources::Resource working_res)
+{
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  const int modval = 100;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  std::vector<DATA_TYPE> ref_sum(num_bins, 1);
+  std::vector<DATA_TYPE> ref_max(num_bins, -1);
+  DATA_TYPE ref_total = 0;
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    IDX_TYPE idx = seg_idx[i];
+    int bin = static_cast<int>( RAJA::stripIndexType(idx) % num_bins );
+    ref_sum[bin] += test_array[idx];
+    ref_max[bin] = RAJA_MAX(test_array[idx], ref_max[bin]);
+    ref_total += test_array[idx];
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  std::vector<DATA_TYPE> sum(num_bins, 1);
+  std::vector<DATA_TYPE> max(num_bins, -1);
+  DATA_TYPE total = 0;
+
+  RAJA::forall<EXEC_POLICY>(seg,
+    RAJA::expt::ReduceArray<RAJA::operators::plus>(sum.data(), num_bins),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&total),
+    RAJA::expt::ReduceArray<RAJA::operators::maximum>(max.data(), num_bins),
+    [=](IDX_TYPE idx, DATA_TYPE* s, DATA_TYPE& t, DATA_TYPE* m) {
+      int bin = static_cast<int>( RAJA::stripIndexType(idx) % num_bins );
+      s[bin] += working_array[idx];
+      t += working_array[idx];
+      m[bin] = RAJA_MAX(working_array[idx], m[bin]);
+  });
+
+  ASSERT_EQ(total, ref_total);
+  for (int b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(sum[b], ref_sum[b]);
+    ASSERT_EQ(max[b], ref_max[b]);
+  }
+
+  const int nloops = 2;
+
+  for (int j = 0; j < nloops; ++j) {
+    RAJA::forall<EXEC_POLICY>(seg,
+      RAJA::expt::ReduceArray<RAJA::operators::plus>(sum.data(), num_bins),
+      [=](IDX_TYPE idx, DATA_TYPE* s) {
+        s[ RAJA::stripIndexType(idx) % num_bins ] += working_array[idx];
+    });
+  }
+
+  for (int b = 0; b < num_bins; ++b) {
+    ASSERT_EQ(sum[b], static_cast<DATA_TYPE>(ref_sum[b] + nloops * (ref_sum[b] - 1)));
+  }
+
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallReduceArrayBasicTest);
+template <typename T>
+class ForallReduceArrayBasicTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReduceArrayBasicTest, ReduceArrayBasicForall)
+{
+  using IDX_TYPE      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<3>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallReduceArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r1, seg_idx, 5, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 642 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallReduceArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r2, seg_idx, 64, working_res);
+
+  // more bins than iterates, and more than one merge block
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r3( 0, 2057 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallReduceArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r3, seg_idx, 3001, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r4( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r4);
+  ForallReduceArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r4, seg_idx, 17, working_res);
+
+// List segment tests
+  seg_idx.clear();
+  IDX_TYPE last = 10567;
+  srand( time(NULL) );
+  for (IDX_TYPE i = 0; i < last; ++i) {
+    IDX_TYPE randval = IDX_TYPE( rand() % RAJA::stripIndexType(last) );
+    if ( i < randval ) {
+      seg_idx.push_back(i);
+    }
+  }
+  RAJA::TypedListSegment<IDX_TYPE> l1( &seg_idx[0], seg_idx.size(),
+                                       working_res );
+  ForallReduceArrayBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedListSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   l1, seg_idx, 100, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceArrayBasicTest,
+                            ReduceArrayBasicForall);
+
+#endif  // __TEST_FORALL_BASIC_REDUCEARRAY_HPP__
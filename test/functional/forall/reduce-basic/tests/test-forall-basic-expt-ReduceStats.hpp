@@ -0,0 +1,183 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BASIC_REDUCESTATS_HPP__
+#define __TEST_FORALL_BASIC_REDUCESTATS_HPP__
+
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <numeric>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceStatsBasicTestImpl(const SEG_TYPE& seg,
+                                    const std::vector<IDX_TYPE>& seg_idx,
+                                    camp::resources::Resource working_res)
+{
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  // values far from zero relative to their spread, where a sum of squares
+  // loses the variance
+  const int offset = 1000;
+  const int modval = 100;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( offset + rand() % modval );
+  }
+
+  DATA_TYPE ref_min = test_array[ seg_idx[0] ];
+  DATA_TYPE ref_max = test_array[ seg_idx[0] ];
+  double ref_mean = 0.0;
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    ref_min = RAJA_MIN(test_array[ seg_idx[i] ], ref_min);
+    ref_max = RAJA_MAX(test_array[ seg_idx[i] ], ref_max);
+    ref_mean += test_array[ seg_idx[i] ];
+  }
+  ref_mean /= idx_len;
+  double ref_m2 = 0.0;
+  for (IDX_TYPE i = 0; i < idx_len; ++i) {
+    double dev = test_array[ seg_idx[i] ] - ref_mean;
+    ref_m2 += dev * dev;
+  }
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  RAJA::expt::Stats<DATA_TYPE> stats;
+  DATA_TYPE sum = 0;
+
+  RAJA::forall<EXEC_POLICY>(seg,
+    RAJA::expt::ReduceStats(&stats),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+    [=](IDX_TYPE idx, RAJA::expt::Stats<DATA_TYPE>& st, DATA_TYPE& s) {
+      st += working_array[idx];
+      s += working_array[idx];
+  });
+
+  const double tol = 1.0e-4;
+
+  ASSERT_EQ(stats.getCount(), static_cast<RAJA::Index_type>(idx_len));
+  ASSERT_EQ(stats.getMin(), ref_min);
+  ASSERT_EQ(stats.getMax(), ref_max);
+  ASSERT_NEAR(stats.getMean(), ref_mean, tol * ref_mean);
+  ASSERT_NEAR(stats.getVariance(), ref_m2 / idx_len,
+              tol * (ref_m2 / idx_len) + tol);
+  if (idx_len > 1) {
+    ASSERT_NEAR(stats.getSampleVariance(), ref_m2 / (idx_len - 1),
+                tol * (ref_m2 / (idx_len - 1)) + tol);
+  }
+  ASSERT_NEAR(static_cast<double>(sum), ref_mean * idx_len,
+              tol * ref_mean * idx_len);
+
+  // reducing again adds the new values to the same statistics
+  RAJA::forall<EXEC_POLICY>(seg,
+    RAJA::expt::ReduceStats(&stats),
+    [=](IDX_TYPE idx, RAJA::expt::Stats<DATA_TYPE>& st) {
+      st.add(working_array[idx]);
+  });
+
+  ASSERT_EQ(stats.getCount(), static_cast<RAJA::Index_type>(2 * idx_len));
+  ASSERT_EQ(stats.getMin(), ref_min);
+  ASSERT_EQ(stats.getMax(), ref_max);
+  ASSERT_NEAR(stats.getMean(), ref_mean, tol * ref_mean);
+  ASSERT_NEAR(stats.getVariance(), ref_m2 / idx_len,
+              tol * (ref_m2 / idx_len) + tol);
+
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallReduceStatsBasicTest);
+template <typename T>
+class ForallReduceStatsBasicTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReduceStatsBasicTest, ReduceStatsBasicForall)
+{
+  using IDX_TYPE      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<3>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallReduceStatsBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r1, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 642 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallReduceStatsBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r2, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r3( 0, 2057 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallReduceStatsBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r3, seg_idx, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r4( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r4);
+  ForallReduceStatsBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   r4, seg_idx, working_res);
+
+// List segment tests
+  seg_idx.clear();
+  IDX_TYPE last = 10567;
+  srand( time(NULL) );
+  for (IDX_TYPE i = 0; i < last; ++i) {
+    IDX_TYPE randval = IDX_TYPE( rand() % RAJA::stripIndexType(last) );
+    if ( i < randval ) {
+      seg_idx.push_back(i);
+    }
+  }
+  RAJA::TypedListSegment<IDX_TYPE> l1( &seg_idx[0], seg_idx.size(),
+                                       working_res );
+  ForallReduceStatsBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                 RAJA::TypedListSegment<IDX_TYPE>,
+                                 EXEC_POLICY, REDUCE_POLICY>(
+                                   l1, seg_idx, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceStatsBasicTest,
+                            ReduceStatsBasicForall);
+
+#endif  // __TEST_FORALL_BASIC_REDUCESTATS_HPP__
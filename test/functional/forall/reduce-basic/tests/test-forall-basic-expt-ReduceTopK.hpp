@@ -0,0 +1,172 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_FORALL_BASIC_REDUCETOPK_HPP__
+#define __TEST_FORALL_BASIC_REDUCETOPK_HPP__
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <numeric>
+#include <vector>
+
+template <typename IDX_TYPE, typename DATA_TYPE,
+          typename SEG_TYPE,
+          typename EXEC_POLICY, typename REDUCE_POLICY>
+void ForallReduceTopKBasicTestImpl(const SEG_TYPE& seg,
+                                   const std::vector<IDX_TYPE>& seg_idx,
+                                   camp::resources::Resource working_res)
+{
+  IDX_TYPE data_len = seg_idx[seg_idx.size() - 1] + 1;
+  IDX_TYPE idx_len = static_cast<IDX_TYPE>( seg_idx.size() );
+
+  DATA_TYPE* working_array;
+  DATA_TYPE* check_array;
+  DATA_TYPE* test_array;
+
+  allocateForallTestData<DATA_TYPE>(data_len,
+                                    working_res,
+                                    &working_array,
+                                    &check_array,
+                                    &test_array);
+
+  // few distinct values, so ties have to be broken by index
+  const int modval = 20;
+
+  for (IDX_TYPE i = 0; i < data_len; ++i) {
+    test_array[i] = static_cast<DATA_TYPE>( rand() % modval );
+  }
+
+  // reference order of the indices, ties in index order
+  std::vector<IDX_TYPE> largest(seg_idx);
+  std::stable_sort(largest.begin(), largest.end(),
+                   [&](IDX_TYPE a, IDX_TYPE b) {
+                     return test_array[a] > test_array[b];
+                   });
+  std::vector<IDX_TYPE> smallest(seg_idx);
+  std::stable_sort(smallest.begin(), smallest.end(),
+                   [&](IDX_TYPE a, IDX_TYPE b) {
+                     return test_array[a] < test_array[b];
+                   });
+
+  working_res.memcpy(working_array, test_array, sizeof(DATA_TYPE) * data_len);
+
+  constexpr int K_LARGEST = 4;
+  constexpr int K_SMALLEST = 40;
+
+  using TOPK_TYPE = RAJA::expt::TopK<DATA_TYPE, K_LARGEST>;
+  using BOTTOMK_TYPE =
+      RAJA::expt::TopK<DATA_TYPE, K_SMALLEST, RAJA::operators::less<DATA_TYPE>>;
+
+  TOPK_TYPE topk;
+  BOTTOMK_TYPE bottomk;
+
+  RAJA::forall<EXEC_POLICY>(seg,
+    RAJA::expt::ReduceTopK<K_LARGEST>(&topk),
+    RAJA::expt::ReduceTopK<K_SMALLEST>(&bottomk),
+    [=](IDX_TYPE idx, TOPK_TYPE& tk, BOTTOMK_TYPE& bk) {
+      tk.add(working_array[idx], RAJA::stripIndexType(idx));
+      bk.add(working_array[idx], RAJA::stripIndexType(idx));
+  });
+
+  RAJA::expt::ValLoc<DATA_TYPE> top[K_LARGEST];
+  const int num_top = topk.getSorted(top);
+  ASSERT_EQ(num_top, std::min(K_LARGEST, static_cast<int>(idx_len)));
+  for (int i = 0; i < num_top; ++i) {
+    ASSERT_EQ(top[i].getVal(), test_array[ largest[i] ]);
+    ASSERT_EQ(top[i].getLoc(), RAJA::stripIndexType(largest[i]));
+  }
+
+  RAJA::expt::ValLoc<DATA_TYPE> bottom[K_SMALLEST];
+  const int num_bottom = bottomk.getSorted(bottom);
+  ASSERT_EQ(num_bottom, std::min(K_SMALLEST, static_cast<int>(idx_len)));
+  for (int i = 0; i < num_bottom; ++i) {
+    ASSERT_EQ(bottom[i].getVal(), test_array[ smallest[i] ]);
+    ASSERT_EQ(bottom[i].getLoc(), RAJA::stripIndexType(smallest[i]));
+  }
+
+
+  deallocateForallTestData<DATA_TYPE>(working_res,
+                                      working_array,
+                                      check_array,
+                                      test_array);
+}
+
+
+TYPED_TEST_SUITE_P(ForallReduceTopKBasicTest);
+template <typename T>
+class ForallReduceTopKBasicTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ForallReduceTopKBasicTest, ReduceTopKBasicForall)
+{
+  using IDX_TYPE      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using DATA_TYPE     = typename camp::at<TypeParam, camp::num<1>>::type;
+  using WORKING_RES   = typename camp::at<TypeParam, camp::num<2>>::type;
+  using EXEC_POLICY   = typename camp::at<TypeParam, camp::num<3>>::type;
+  using REDUCE_POLICY = typename camp::at<TypeParam, camp::num<4>>::type;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+
+  std::vector<IDX_TYPE> seg_idx;
+
+// Range segment tests
+  RAJA::TypedRangeSegment<IDX_TYPE> r1( 0, 28 );
+  RAJA::getIndices(seg_idx, r1);
+  ForallReduceTopKBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                RAJA::TypedRangeSegment<IDX_TYPE>,
+                                EXEC_POLICY, REDUCE_POLICY>(
+                                  r1, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r2( 3, 642 );
+  RAJA::getIndices(seg_idx, r2);
+  ForallReduceTopKBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                RAJA::TypedRangeSegment<IDX_TYPE>,
+                                EXEC_POLICY, REDUCE_POLICY>(
+                                  r2, seg_idx, working_res);
+
+  seg_idx.clear();
+  RAJA::TypedRangeSegment<IDX_TYPE> r3( 0, 2057 );
+  RAJA::getIndices(seg_idx, r3);
+  ForallReduceTopKBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                RAJA::TypedRangeSegment<IDX_TYPE>,
+                                EXEC_POLICY, REDUCE_POLICY>(
+                                  r3, seg_idx, working_res);
+
+// Range-stride segment tests
+  seg_idx.clear();
+  RAJA::TypedRangeStrideSegment<IDX_TYPE> r4( 3, 1029, 3 );
+  RAJA::getIndices(seg_idx, r4);
+  ForallReduceTopKBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                RAJA::TypedRangeStrideSegment<IDX_TYPE>,
+                                EXEC_POLICY, REDUCE_POLICY>(
+                                  r4, seg_idx, working_res);
+
+// List segment tests
+  seg_idx.clear();
+  IDX_TYPE last = 10567;
+  srand( time(NULL) );
+  for (IDX_TYPE i = 0; i < last; ++i) {
+    IDX_TYPE randval = IDX_TYPE( rand() % RAJA::stripIndexType(last) );
+    if ( i < randval ) {
+      seg_idx.push_back(i);
+    }
+  }
+  RAJA::TypedListSegment<IDX_TYPE> l1( &seg_idx[0], seg_idx.size(),
+                                       working_res );
+  ForallReduceTopKBasicTestImpl<IDX_TYPE, DATA_TYPE,
+                                RAJA::TypedListSegment<IDX_TYPE>,
+                                EXEC_POLICY, REDUCE_POLICY>(
+                                  l1, seg_idx, working_res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ForallReduceTopKBasicTest,
+                            ReduceTopKBasicForall);
+
+#endif  // __TEST_FORALL_BASIC_REDUCETOPK_HPP__
@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for lock-free block index sets executed
+/// with the OpenMP dependency graph segment iteration policies.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+#include "RAJA/internal/ThreadUtils_CPU.hpp"
+
+#include <atomic>
+#include <vector>
+
+TEST(IndexSetBuild, LockFreeBlockTaskgraph)
+{
+  const int fastDim = 8;
+  const int midDim = 8;
+  const int slowDim = 16 * RAJA::getMaxOMPThreadsCPU();
+  const int len = fastDim * midDim * slowDim;
+
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(static_cast<int>(iset.getLength()), len);
+
+  const int num_seg = iset.getNumSegments();
+
+  using exec_policy =
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  std::vector<int> counts(len, 0);
+  int* counts_ptr = counts.data();
+
+  // executing twice checks the graph is ready for reuse
+  for (int rep = 1; rep <= 2; ++rep) {
+
+    std::vector<std::atomic<int>> finished(num_seg);
+    std::atomic<int> clock(0);
+
+    RAJA::forall<exec_policy>(
+        iset, [=](RAJA::Index_type i) { counts_ptr[i] += 1; });
+
+    for (int i = 0; i < len; ++i) {
+      ASSERT_EQ(counts[i], rep);
+    }
+
+    // record segment completion order
+    RAJA::forall<exec_policy>(iset, [&](RAJA::Index_type i) {
+      for (int seg = 0; seg < num_seg; ++seg) {
+        const RAJA::RangeSegment& s = iset.getSegment<const RAJA::RangeSegment>(seg);
+        if (i == *(s.end() - 1)) {
+          finished[seg] = clock++;
+        }
+      }
+    });
+
+    // segments waiting on a lower numbered segment finished after it
+    for (int seg = 0; seg < num_seg; ++seg) {
+      RAJA::DepGraphNode* task = iset.getDepGraphNode(seg);
+      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+        const int dep = task->depTaskNum(ii);
+        if (dep > seg) {
+          ASSERT_LT(finished[seg].load(), finished[dep].load());
+        }
+      }
+    }
+  }
+}
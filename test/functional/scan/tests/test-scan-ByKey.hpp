@@ -0,0 +1,147 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_BYKEY_HPP__
+#define __TEST_SCAN_BYKEY_HPP__
+
+#include <cstdlib>
+#include <numeric>
+
+template <typename OP, typename T>
+::testing::AssertionResult check_by_key(const T* actual,
+                                        const T* original,
+                                        const int* keys,
+                                        int N,
+                                        bool exclusive,
+                                        T init)
+{
+  T agg = init;
+  for (int i = 0; i < N; ++i) {
+    if (i > 0 && keys[i] != keys[i - 1]) {
+      agg = init;
+    }
+    T expected = exclusive ? agg : OP()(agg, original[i]);
+    agg = OP()(agg, original[i]);
+    if (actual[i] != expected) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected << " (at index " << i << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanByKeyTestImpl(int N, int max_run,
+                       typename OP_TYPE::result_type offset =
+                       OP_TYPE::identity())
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  int* work_keys = working_res.allocate<int>(N);
+  int* host_keys = host_res.allocate<int>(N);
+
+  std::iota(host_in, host_in + N, 1);
+
+  // runs of equal keys with lengths in [1, max_run], a key may repeat after
+  // a different one
+  int key = 0;
+  for (int i = 0; i < N; ) {
+    int run = 1 + rand() % max_run;
+    for (; run > 0 && i < N; --run, ++i) {
+      host_keys[i] = key;
+    }
+    key = (key + 1) % 3;
+  }
+
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.memcpy(work_keys, host_keys, sizeof(int) * N);
+  res.wait();
+
+  // test inclusive interface without resource
+  RAJA::inclusive_scan_by_key<EXEC_POLICY>(RAJA::make_span(static_cast<const int*>(work_keys), N),
+                                           RAJA::make_span(static_cast<const T*>(work_in), N),
+                                           RAJA::make_span(work_out, N),
+                                           OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_by_key<OP_TYPE>(host_out, host_in, host_keys, N,
+                                    false, OP_TYPE::identity()));
+
+  // test exclusive interface with resource
+  RAJA::exclusive_scan_by_key<EXEC_POLICY>(res,
+                                           RAJA::make_span(static_cast<const int*>(work_keys), N),
+                                           RAJA::make_span(static_cast<const T*>(work_in), N),
+                                           RAJA::make_span(work_out, N),
+                                           OP_TYPE{},
+                                           offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_by_key<OP_TYPE>(host_out, host_in, host_keys, N,
+                                    true, offset));
+
+  working_res.deallocate(work_keys);
+  host_res.deallocate(host_keys);
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanByKeyTest);
+template <typename T>
+class ScanByKeyTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanByKeyTest, ScanByKey)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  using T = typename OP_TYPE::result_type;
+
+  ScanByKeyTestImpl<EXEC_POLICY,
+                    WORKING_RESOURCE,
+                    OP_TYPE>(0, 1);
+  ScanByKeyTestImpl<EXEC_POLICY,
+                    WORKING_RESOURCE,
+                    OP_TYPE>(357, 1);
+  ScanByKeyTestImpl<EXEC_POLICY,
+                    WORKING_RESOURCE,
+                    OP_TYPE>(357, 20, T(15));
+  ScanByKeyTestImpl<EXEC_POLICY,
+                    WORKING_RESOURCE,
+                    OP_TYPE>(32000, 3);
+  ScanByKeyTestImpl<EXEC_POLICY,
+                    WORKING_RESOURCE,
+                    OP_TYPE>(32000, 5000, T(2));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanByKeyTest,
+                            ScanByKey);
+
+#endif // __TEST_SCAN_BYKEY_HPP__
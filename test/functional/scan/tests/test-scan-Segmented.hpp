@@ -0,0 +1,146 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_SCAN_SEGMENTED_HPP__
+#define __TEST_SCAN_SEGMENTED_HPP__
+
+#include <cstdlib>
+#include <numeric>
+
+template <typename OP, typename T>
+::testing::AssertionResult check_segmented(const T* actual,
+                                           const T* original,
+                                           const int* flags,
+                                           int N,
+                                           bool exclusive,
+                                           T init)
+{
+  T agg = init;
+  for (int i = 0; i < N; ++i) {
+    if (i > 0 && flags[i]) {
+      agg = init;
+    }
+    T expected = exclusive ? agg : OP()(agg, original[i]);
+    agg = OP()(agg, original[i]);
+    if (actual[i] != expected) {
+      return ::testing::AssertionFailure()
+             << actual[i] << " != " << expected << " (at index " << i << ")";
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+template <typename EXEC_POLICY, typename WORKING_RES, typename OP_TYPE>
+void ScanSegmentedTestImpl(int N, int max_run,
+                           typename OP_TYPE::result_type offset =
+                           OP_TYPE::identity())
+{
+  using T = typename OP_TYPE::result_type;
+
+  WORKING_RES res{WORKING_RES::get_default()};
+  camp::resources::Resource working_res{res};
+  camp::resources::Resource host_res{camp::resources::Host()};
+
+  T* work_in;
+  T* work_out;
+  T* host_in;
+  T* host_out;
+
+  allocScanTestData(N,
+                    working_res,
+                    &work_in, &work_out,
+                    &host_in, &host_out);
+
+  int* work_flags = working_res.allocate<int>(N);
+  int* host_flags = host_res.allocate<int>(N);
+
+  std::iota(host_in, host_in + N, 1);
+
+  // a flag at the start of every run of length in [1, max_run], including
+  // index 0
+  for (int i = 0; i < N; ) {
+    int run = 1 + rand() % max_run;
+    host_flags[i] = 1;
+    for (++i, --run; run > 0 && i < N; --run, ++i) {
+      host_flags[i] = 0;
+    }
+  }
+
+  res.memcpy(work_in, host_in, sizeof(T) * N);
+  res.memcpy(work_flags, host_flags, sizeof(int) * N);
+  res.wait();
+
+  // test inclusive interface without resource
+  RAJA::inclusive_segmented_scan<EXEC_POLICY>(RAJA::make_span(static_cast<const int*>(work_flags), N),
+                                              RAJA::make_span(static_cast<const T*>(work_in), N),
+                                              RAJA::make_span(work_out, N),
+                                              OP_TYPE{});
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented<OP_TYPE>(host_out, host_in, host_flags, N,
+                                       false, OP_TYPE::identity()));
+
+  // test exclusive interface with resource
+  RAJA::exclusive_segmented_scan<EXEC_POLICY>(res,
+                                              RAJA::make_span(static_cast<const int*>(work_flags), N),
+                                              RAJA::make_span(static_cast<const T*>(work_in), N),
+                                              RAJA::make_span(work_out, N),
+                                              OP_TYPE{},
+                                              offset);
+
+  res.memcpy(host_out, work_out, sizeof(T) * N);
+  res.wait();
+
+  ASSERT_TRUE(check_segmented<OP_TYPE>(host_out, host_in, host_flags, N,
+                                       true, offset));
+
+  working_res.deallocate(work_flags);
+  host_res.deallocate(host_flags);
+
+  deallocScanTestData(working_res,
+                      work_in, work_out,
+                      host_in, host_out);
+}
+
+
+TYPED_TEST_SUITE_P(ScanSegmentedTest);
+template <typename T>
+class ScanSegmentedTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(ScanSegmentedTest, ScanSegmented)
+{
+  using EXEC_POLICY      = typename camp::at<TypeParam, camp::num<0>>::type;
+  using WORKING_RESOURCE = typename camp::at<TypeParam, camp::num<1>>::type;
+  using OP_TYPE          = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  using T = typename OP_TYPE::result_type;
+
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(0, 1);
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(357, 1);
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(357, 20, T(15));
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(32000, 3);
+  ScanSegmentedTestImpl<EXEC_POLICY,
+                        WORKING_RESOURCE,
+                        OP_TYPE>(32000, 5000, T(2));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ScanSegmentedTest,
+                            ScanSegmented);
+
+#endif // __TEST_SCAN_SEGMENTED_HPP__
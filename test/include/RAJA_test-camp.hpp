@@ -42,4 +42,8 @@ using HipResourceList = camp::list<camp::resources::Hip>;
 using SyclResourceList = camp::list<camp::resources::Sycl>;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolResourceList = HostResourceList;
+#endif
+
 #endif // __RAJA_test_camp_HPP__
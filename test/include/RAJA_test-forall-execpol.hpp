@@ -35,6 +35,8 @@ using OpenMPForallExecPols =
               , RAJA::omp_parallel_for_static_exec< >
               , RAJA::omp_parallel_for_static_exec<4>
 
+              , RAJA::omp_numa_static_exec
+
 #if defined(RAJA_TEST_EXHAUSTIVE)
               , RAJA::omp_parallel_for_dynamic_exec< >
               , RAJA::omp_parallel_for_dynamic_exec<4>
@@ -88,6 +90,8 @@ using OpenMPForallAtomicExecPols =
               , RAJA::omp_parallel_for_guided_exec<3>
 
               , RAJA::omp_parallel_for_runtime_exec
+
+              , RAJA::omp_numa_static_exec
 #endif
             >; 
 
@@ -137,4 +141,11 @@ using SyclForallAtomicExecPols = SyclForallExecPols;
 
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolForallExecPols = camp::list< RAJA::thread_pool_exec >;
+
+using ThreadPoolForallReduceExecPols = ThreadPoolForallExecPols;
+
+#endif
+
 #endif  // __RAJA_test_forall_execpol_HPP__
@@ -70,4 +70,15 @@ using SyclForallIndexSetExecPols =
 using SyclForallIndexSetReduceExecPols = SyclForallIndexSetExecPols;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolForallIndexSetExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::thread_pool_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::thread_pool_segit, RAJA::simd_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::thread_pool_exec> >;
+
+using ThreadPoolForallIndexSetReduceExecPols =
+  camp::list< RAJA::ExecPolicy<RAJA::thread_pool_segit, RAJA::seq_exec>,
+              RAJA::ExecPolicy<RAJA::seq_segit, RAJA::thread_pool_exec> >;
+#endif
+
 #endif  // __RAJA_test_forall_indexset_execpol_HPP__
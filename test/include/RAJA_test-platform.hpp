@@ -45,4 +45,8 @@ using OpenMPTargetPlatformList = camp::list<PlatformHolder<RAJA::Platform::omp_t
 using HipPlatformList = camp::list<PlatformHolder<RAJA::Platform::hip>>;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolPlatformList = HostPlatformList;
+#endif
+
 #endif // __RAJA_test_platform_HPP__
@@ -22,9 +22,12 @@ using SequentialReducePols = camp::list< RAJA::seq_reduce >;
 using OpenMPReducePols = 
 #if 0 // is ordered reduction broken???
   camp::list< RAJA::omp_reduce,
-              RAJA::omp_reduce_ordered >;
+              RAJA::omp_reduce_ordered,
+              RAJA::omp_reduce_padded >;
 #else
-  camp::list< RAJA::omp_reduce >;
+  camp::list< RAJA::omp_reduce,
+              RAJA::omp_reduce_padded,
+              RAJA::omp_reduce_repro >;
 #endif
 #endif
 
@@ -45,4 +48,8 @@ using HipReducePols = camp::list< RAJA::hip_reduce >;
 using SyclReducePols = camp::list< RAJA::sycl_reduce >;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolReducePols = camp::list< RAJA::thread_pool_reduce >;
+#endif
+
 #endif  // __RAJA_test_reducepol_HPP__
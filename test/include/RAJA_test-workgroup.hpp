@@ -348,10 +348,25 @@ using OpenMPExecPolicyList =
                 RAJA::omp_work
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_fused_iteration_space
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolExecPolicyList =
+    camp::list<
+                RAJA::thread_pool_work
+              >;
+using ThreadPoolOrderedPolicyList = SequentialOrderedPolicyList;
+using ThreadPoolOrderPolicyList   = SequentialOrderPolicyList;
+using ThreadPoolStoragePolicyList = SequentialStoragePolicyList;
+#endif
+
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
 using OpenMPTargetExecPolicyList =
     camp::list<
@@ -421,6 +436,10 @@ using SequentialAllocatorList = HostAllocatorList;
 using OpenMPAllocatorList = HostAllocatorList;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolAllocatorList = HostAllocatorList;
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 using CudaAllocatorList = camp::list<typename detail::ResourceAllocator<camp::resources::Cuda>::template std_allocator<char>>;
 #endif
@@ -139,6 +139,10 @@ using SequentialUnitTestPolicyList = camp::list<test_seq>;
 using OpenMPUnitTestPolicyList = SequentialUnitTestPolicyList;
 #endif
 
+#if defined(RAJA_ENABLE_THREAD_POOL)
+using ThreadPoolUnitTestPolicyList = SequentialUnitTestPolicyList;
+#endif
+
 #if defined(RAJA_ENABLE_CUDA)
 using CudaUnitTestPolicyList = camp::list<test_cuda>;
 #endif
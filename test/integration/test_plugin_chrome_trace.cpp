@@ -0,0 +1,56 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// RAJA_CHROME_TRACE is set by the test driver, so the built-in
+// ChromeTracePlugin is active from startup
+TEST(PluginTestChromeTrace, WritesKernels)
+{
+  const char* path = std::getenv("RAJA_CHROME_TRACE");
+  ASSERT_NE(path, nullptr);
+
+  int* a = new int[10];
+
+  // two kernels from the same call site with different names
+  for (const char* name : {"first_kernel", "second_kernel"}) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 10),
+                                 RAJA::expt::KernelName(name),
+                                 [=](int i) { a[i] = i; });
+  }
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 7),
+                               [=](int i) { a[i] = 0; });
+
+  RAJA::util::finalize_plugins();
+
+  delete[] a;
+
+  std::ifstream file(path);
+  ASSERT_TRUE(file.good());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  const std::string trace = contents.str();
+
+  ASSERT_EQ(trace.find("{\"traceEvents\":["), 0u);
+  ASSERT_NE(trace.find("\"name\":\"first_kernel\",\"cat\":\""),
+            std::string::npos);
+  ASSERT_NE(trace.find("\"name\":\"second_kernel\",\"cat\":\""),
+            std::string::npos);
+  ASSERT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+  ASSERT_NE(trace.find("\"iterations\":10,"), std::string::npos);
+  ASSERT_NE(trace.find("\"iterations\":7,"), std::string::npos);
+  ASSERT_NE(trace.find("\"platform\":\"host\""), std::string::npos);
+  ASSERT_NE(trace.find("\"otherData\":{\"dropped_events\":0}}"),
+            std::string::npos);
+}
@@ -0,0 +1,78 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA/RAJA.hpp"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// RAJA_PERF_EVENTS is set by the test driver to a CSV path, so the built-in
+// PerfEventPlugin is active from startup. Machines without perf_event
+// access take the counters unavailable path, which writes no CSV.
+TEST(PluginTestPerfEvents, WritesKernels)
+{
+  const char* path = std::getenv("RAJA_PERF_EVENTS");
+  ASSERT_NE(path, nullptr);
+  std::remove(path);
+
+  int* a = new int[100];
+
+  for (int r = 0; r < 3; ++r) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, 100),
+                                 RAJA::expt::KernelName("perf_forall"),
+                                 [=](int i) { a[i] = i; });
+  }
+
+  using KERNEL_POL =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  RAJA::kernel<KERNEL_POL>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, 10), RAJA::RangeSegment(0, 10)),
+      [=](int i, int j) { a[i + 10 * j] += 1; });
+
+  RAJA::util::finalize_plugins();
+
+  delete[] a;
+
+  std::ifstream file(path);
+  if (!file.good()) {
+    // counters unavailable, nothing was counted or written
+    return;
+  }
+
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(line);
+  }
+  std::remove(path);
+
+  // header and one row for each of the two kernels
+  ASSERT_EQ(lines.size(), 3u);
+  ASSERT_EQ(lines[0],
+            "kernel,launches,cycles,instructions,llc_misses,branch_misses");
+
+  int forall_rows = 0;
+  for (size_t l = 1; l < lines.size(); ++l) {
+    ASSERT_EQ(lines[l][0], '"');
+    if (lines[l].find("\"perf_forall\",3,") == 0) {
+      ++forall_rows;
+    } else {
+      ASSERT_NE(lines[l].find("\",1,"), std::string::npos);
+    }
+  }
+  ASSERT_EQ(forall_rows, 1);
+}
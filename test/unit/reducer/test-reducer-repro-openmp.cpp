@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for reproducible OpenMP sum reductions.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <omp.h>
+
+// values over a wide range of magnitudes, so that a sum in a different
+// order rounds differently
+static std::vector<double> reproTestData(int N)
+{
+  std::mt19937_64 gen(12345);
+  std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+  std::vector<double> data(N);
+  for (int i = 0; i < N; ++i) {
+    data[i] = std::ldexp(mantissa(gen), static_cast<int>(gen() % 80) - 40);
+  }
+  return data;
+}
+
+TEST(ReproSumUnitTest, ExactCancellation)
+{
+  RAJA::ReproSum<double> sum;
+  sum += 1.0e100;
+  sum += 1.0;
+  sum += -1.0e100;
+  ASSERT_EQ(sum.get(), 1.0);
+
+  RAJA::ReproSum<double> other(-0.5);
+  sum += other;
+  ASSERT_EQ(sum.get(), 0.5);
+
+  RAJA::ReproSum<float> fsum;
+  ASSERT_EQ(fsum.get(), 0.0f);
+  fsum += 1.0e30f;
+  fsum += 3.0f;
+  fsum += -1.0e30f;
+  ASSERT_EQ(fsum.get(), 3.0f);
+}
+
+TEST(ReproSumUnitTest, FloatRoundsOnce)
+{
+  // 1 + 2^-24 + 2^-80 is just above the float halfway point 1 + 2^-24, but
+  // rounds to it as a double, which would then round to even, i.e. to 1
+  RAJA::ReproSum<float> sum;
+  sum += 1.0f;
+  sum += std::ldexp(1.0f, -24);
+  sum += std::ldexp(1.0f, -80);
+  ASSERT_EQ(sum.get(), std::nextafter(1.0f, 2.0f));
+
+  // an exact tie still rounds to even
+  RAJA::ReproSum<float> tie;
+  tie += 1.0f;
+  tie += std::ldexp(1.0f, -24);
+  ASSERT_EQ(tie.get(), 1.0f);
+}
+
+TEST(ReproSumUnitTest, NonFinite)
+{
+  RAJA::ReproSum<double> sum;
+  sum += 1.0;
+  sum += INFINITY;
+  ASSERT_EQ(sum.get(), INFINITY);
+  sum += -INFINITY;
+  ASSERT_TRUE(std::isnan(sum.get()));
+}
+
+TEST(ReproReducerUnitTest, ReduceSumThreadCounts)
+{
+  const int N = 100003;
+  const std::vector<double> data = reproTestData(N);
+  const double* a = data.data();
+
+  RAJA::ReproSum<double> ref(2.0);
+  for (int i = 0; i < N; ++i) {
+    ref += a[i];
+  }
+
+  const int max_threads = omp_get_max_threads();
+  for (int nthreads : {1, 2, 3, 7, 16}) {
+    omp_set_num_threads(nthreads);
+
+    RAJA::ReduceSum<RAJA::omp_reduce_repro, double> sum(2.0);
+    RAJA::forall<RAJA::omp_parallel_for_dynamic_exec<13>>(
+        RAJA::RangeSegment(0, N),
+        [=](int i) { sum += a[i]; });
+
+    ASSERT_EQ(sum.get(), ref.get());
+  }
+  omp_set_num_threads(max_threads);
+}
+
+TEST(ReproReducerUnitTest, ExptReduceThreadCounts)
+{
+  const int N = 100003;
+  const std::vector<double> data = reproTestData(N);
+  const double* a = data.data();
+
+  double seq_sum = 0.0;
+  RAJA::forall<RAJA::seq_exec>(
+      RAJA::RangeSegment(0, N),
+      RAJA::expt::Reduce<RAJA::operators::repro_plus>(&seq_sum),
+      [=](int i, RAJA::ReproSum<double>& s) { s += a[i]; });
+
+  const int max_threads = omp_get_max_threads();
+  for (int nthreads : {1, 2, 3, 7, 16}) {
+    omp_set_num_threads(nthreads);
+
+    double sum = 0.0;
+    RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::RangeSegment(0, N),
+        RAJA::expt::Reduce<RAJA::operators::repro_plus>(&sum),
+        [=](int i, RAJA::ReproSum<double>& s) { s += a[i]; });
+
+    ASSERT_EQ(sum, seq_sum);
+  }
+  omp_set_num_threads(max_threads);
+}
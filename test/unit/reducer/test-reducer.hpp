@@ -24,7 +24,9 @@ using SequentialReducerPolicyList = camp::list< RAJA::seq_reduce >;
 
 #if defined(RAJA_ENABLE_OPENMP)
 using OpenMPReducerPolicyList = camp::list< RAJA::omp_reduce,
-                                            RAJA::omp_reduce_ordered >;
+                                            RAJA::omp_reduce_ordered,
+                                            RAJA::omp_reduce_padded,
+                                            RAJA::omp_reduce_repro >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
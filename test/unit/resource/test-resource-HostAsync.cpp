@@ -0,0 +1,206 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the HostAsync resource
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(RAJA_ENABLE_OPENMP)
+using HostAsyncExecPol = RAJA::omp_parallel_for_exec;
+#else
+using HostAsyncExecPol = RAJA::seq_exec;
+#endif
+
+TEST(HostAsyncResourceTest, ForallRunsOnWorker)
+{
+  constexpr int N = 10000;
+  RAJA::resources::HostAsync res;
+
+  int* array = res.allocate<int>(N);
+
+  std::atomic<bool> gate{false};
+  res.enqueue([&]() {
+    while (!gate) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  RAJA::resources::Event e = RAJA::forall<HostAsyncExecPol>(
+      res, RAJA::RangeSegment(0, N), [=](int i) { array[i] = i; });
+
+  ASSERT_FALSE(e.check());
+
+  gate = true;
+  e.wait();
+
+  ASSERT_TRUE(e.check());
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(array[i], i);
+  }
+
+  res.deallocate(array);
+  res.wait();
+}
+
+TEST(HostAsyncResourceTest, Reduction)
+{
+  constexpr int N = 1000;
+  RAJA::resources::HostAsync res;
+
+  int sum = 0;
+  RAJA::forall<HostAsyncExecPol>(res, RAJA::RangeSegment(0, N),
+    RAJA::expt::Reduce<RAJA::operators::plus>(&sum),
+    [=](int i, int& s) { s += i; });
+
+  RAJA::ReduceSum<RAJA::seq_reduce, int> old_sum(0);
+  RAJA::forall<RAJA::seq_exec>(res, RAJA::RangeSegment(0, N),
+    [=](int i) { old_sum += i; });
+
+  res.wait();
+
+  ASSERT_EQ(sum, N * (N - 1) / 2);
+  ASSERT_EQ(old_sum.get(), N * (N - 1) / 2);
+}
+
+TEST(HostAsyncResourceTest, WaitFor)
+{
+  constexpr int N = 1000;
+  RAJA::resources::HostAsync res1;
+  RAJA::resources::HostAsync res2;
+
+  int* array = res1.allocate<int>(N);
+  int* copy = res2.allocate<int>(N);
+
+  std::atomic<bool> gate{false};
+  res1.enqueue([&]() {
+    while (!gate) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  RAJA::resources::Event e = RAJA::forall<RAJA::seq_exec>(
+      res1, RAJA::RangeSegment(0, N), [=](int i) { array[i] = 2 * i; });
+
+  res2.wait_for(&e);
+  res2.memcpy(copy, array, sizeof(int) * N);
+  RAJA::resources::Event e2 = res2.get_event();
+
+  ASSERT_FALSE(e2.check());
+
+  gate = true;
+  e2.wait();
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(copy[i], 2 * i);
+  }
+
+  res1.deallocate(array);
+  res2.deallocate(copy);
+  res1.wait();
+  res2.wait();
+}
+
+TEST(HostAsyncResourceTest, KernelRunsOnWorker)
+{
+  constexpr int N = 32;
+  RAJA::resources::HostAsync res;
+
+  int* array = res.allocate<int>(N * N);
+
+  using KERNEL_POL =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<1, HostAsyncExecPol,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  std::atomic<bool> gate{false};
+  res.enqueue([&]() {
+    while (!gate) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  RAJA::resources::Event e = RAJA::kernel_resource<KERNEL_POL>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, N)),
+      res,
+      [=](int i, int j) { array[i + N * j] = i * j; });
+
+  ASSERT_FALSE(e.check());
+
+  gate = true;
+  e.wait();
+
+  ASSERT_TRUE(e.check());
+  for (int j = 0; j < N; ++j) {
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(array[i + N * j], i * j);
+    }
+  }
+
+  res.deallocate(array);
+  res.wait();
+}
+
+TEST(HostAsyncResourceTest, LaunchRunsOnWorker)
+{
+  constexpr int N = 64;
+  RAJA::resources::HostAsync res;
+
+  int* array = res.allocate<int>(2 * N);
+
+  using LAUNCH_POL = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+  using LOOP_POL = RAJA::LoopPolicy<RAJA::seq_exec>;
+
+  std::atomic<bool> gate{false};
+  res.enqueue([&]() {
+    while (!gate) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  RAJA::resources::Event e1 = RAJA::launch<LAUNCH_POL>(
+      res, RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(N)),
+      "host_async_launch",
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<LOOP_POL>(ctx, RAJA::RangeSegment(0, N), [&](int i) {
+          array[i] = i;
+        });
+      });
+
+  RAJA::resources::Event e2 = RAJA::launch<LAUNCH_POL>(
+      res, RAJA::LaunchParams(RAJA::Teams(1), RAJA::Threads(N)),
+      [=](RAJA::LaunchContext ctx) {
+        RAJA::loop<LOOP_POL>(ctx, RAJA::RangeSegment(0, N), [&](int i) {
+          array[N + i] = 2 * i;
+        });
+      });
+
+  ASSERT_FALSE(e1.check());
+  ASSERT_FALSE(e2.check());
+
+  gate = true;
+  e2.wait();
+
+  ASSERT_TRUE(e1.check());
+  ASSERT_TRUE(e2.check());
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(array[i], i);
+    ASSERT_EQ(array[N + i], 2 * i);
+  }
+
+  res.deallocate(array);
+  res.wait();
+}
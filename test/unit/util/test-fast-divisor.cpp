@@ -0,0 +1,76 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for FastDivisor
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <limits>
+#include <random>
+
+template <typename T>
+void checkFastDivisor(T d, std::mt19937_64& gen)
+{
+  const T max = std::numeric_limits<T>::max();
+  const RAJA::FastDivisor<T> div(d);
+
+  const T edges[] = {T(0), T(1), T(d - 1), d, T(max / 2),
+                     T(max / d * d), T(max / d * d - 1), T(max - 1), max};
+  for (T n : edges) {
+    ASSERT_EQ(div.divide(n), T(n / d)) << n << " / " << d;
+  }
+
+  for (int k = 0; k < 100; ++k) {
+    const T n = static_cast<T>(gen() & static_cast<unsigned long long>(max));
+    ASSERT_EQ(div.divide(n), T(n / d)) << n << " / " << d;
+  }
+}
+
+template <typename T>
+void testFastDivisor()
+{
+  std::mt19937_64 gen(17);
+  const T max = std::numeric_limits<T>::max();
+
+  for (T d = 1; d < 1000; ++d) {
+    checkFastDivisor<T>(d, gen);
+  }
+
+  // powers of two and their neighbors, up to the largest divisor
+  constexpr int bits = std::numeric_limits<T>::digits;
+  for (int b = 1; b < bits; ++b) {
+    const T p = static_cast<T>(T(1) << b);
+    checkFastDivisor<T>(T(p - 1), gen);
+    checkFastDivisor<T>(p, gen);
+    checkFastDivisor<T>(T(p + 1), gen);
+  }
+  checkFastDivisor<T>(T(max - 1), gen);
+  checkFastDivisor<T>(max, gen);
+
+  for (int k = 0; k < 1000; ++k) {
+    const T d = static_cast<T>(gen() & static_cast<unsigned long long>(max));
+    if (d > 0) {
+      checkFastDivisor<T>(d, gen);
+    }
+  }
+}
+
+TEST(FastDivisor, Default)
+{
+  RAJA::FastDivisor<int> div;
+  ASSERT_EQ(div.divide(12345), 12345);
+}
+
+TEST(FastDivisor, Int) { testFastDivisor<int>(); }
+
+TEST(FastDivisor, Unsigned) { testFastDivisor<unsigned>(); }
+
+TEST(FastDivisor, Long) { testFastDivisor<long long>(); }
+
+TEST(FastDivisor, UnsignedLong) { testFastDivisor<unsigned long long>(); }
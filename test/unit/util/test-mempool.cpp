@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool MemPool modes
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+template <typename Pool>
+void testMemPoolAllocations()
+{
+  Pool pool;
+
+  std::vector<double*> ptrs;
+  size_t requested = 0;
+  for (size_t len : {1, 31, 32, 33, 1000, 100000}) {
+    double* ptr = pool.template malloc<double>(len);
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignof(double), 0u);
+    for (size_t i = 0; i < len; ++i) {
+      ptr[i] = static_cast<double>(i);
+    }
+    ptrs.push_back(ptr);
+    requested += len * sizeof(double);
+  }
+
+  double* aligned = pool.template malloc<double>(10, 4096);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 4096, 0u);
+  requested += 10 * sizeof(double);
+
+  RAJA::basic_mempool::mempool_statistics stats = pool.statistics();
+  ASSERT_EQ(stats.num_allocations, ptrs.size() + 1);
+  ASSERT_GE(stats.used_bytes, requested);
+  ASSERT_GE(stats.reserved_bytes, stats.used_bytes);
+  ASSERT_EQ(stats.high_water_mark_bytes, stats.used_bytes);
+  ASSERT_GE(stats.fragmentation(), 0.0);
+  ASSERT_LT(stats.fragmentation(), 1.0);
+
+  const size_t high_water_mark = stats.high_water_mark_bytes;
+
+  for (double* ptr : ptrs) {
+    pool.free(ptr);
+  }
+  pool.free(aligned);
+
+  stats = pool.statistics();
+  ASSERT_EQ(stats.num_allocations, 0u);
+  ASSERT_EQ(stats.used_bytes, 0u);
+  ASSERT_EQ(stats.high_water_mark_bytes, high_water_mark);
+
+  pool.free_chunks();
+
+  stats = pool.statistics();
+  ASSERT_EQ(stats.reserved_bytes, 0u);
+}
+
+TEST(MemPoolUnitTest, ArenaMode)
+{
+  testMemPoolAllocations<
+      RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>();
+}
+
+TEST(MemPoolUnitTest, SizeClassMode)
+{
+  testMemPoolAllocations<
+      RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator,
+                                   RAJA::basic_mempool::size_class_mode>>();
+}
+
+TEST(MemPoolUnitTest, SizeClassModeThreads)
+{
+  using pool_type =
+      RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator,
+                                   RAJA::basic_mempool::size_class_mode>;
+  pool_type pool;
+
+  const int num_threads = 4;
+  std::vector<int> failures(num_threads, 0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&pool, &failures, t]() {
+      std::vector<int*> ptrs;
+      for (int i = 0; i < 4000; ++i) {
+        int* ptr = pool.malloc<int>(1 + (7 * i + t) % 3000);
+        *ptr = t;
+        ptrs.push_back(ptr);
+        if (ptrs.size() == 16) {
+          for (int* p : ptrs) {
+            failures[t] += (*p != t);
+            pool.free(p);
+          }
+          ptrs.clear();
+        }
+      }
+      for (int* p : ptrs) {
+        pool.free(p);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < num_threads; ++t) {
+    ASSERT_EQ(failures[t], 0);
+  }
+
+  RAJA::basic_mempool::mempool_statistics stats = pool.statistics();
+  ASSERT_EQ(stats.num_allocations, 0u);
+  ASSERT_EQ(stats.used_bytes, 0u);
+
+  pool.free_chunks();
+}
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the NUMA partition used by
+/// omp_numa_static_exec and numa_first_touch_fill.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <vector>
+
+#include <omp.h>
+
+TEST(NumaUnitTest, TeamRangeCoversLength)
+{
+  auto const& partition =
+      RAJA::policy::omp::numa::Partition::get(omp_get_max_threads());
+  const int num_threads = partition.numThreads();
+
+  for (int len : {0, 1, 7, 1000, 1031}) {
+    std::vector<int> count(len, 0);
+#pragma omp parallel num_threads(num_threads)
+    {
+      int begin = 0;
+      int end = 0;
+      RAJA::policy::omp::numa::team_range(partition, len, begin, end);
+      for (int i = begin; i < end; ++i) {
+#pragma omp atomic
+        ++count[i];
+      }
+    }
+    for (int i = 0; i < len; ++i) {
+      ASSERT_EQ(count[i], 1);
+    }
+  }
+}
+
+TEST(NumaUnitTest, TeamRangeSmallerTeam)
+{
+  auto const& partition =
+      RAJA::policy::omp::numa::Partition::get(omp_get_max_threads() + 1);
+  const int len = 100;
+  std::vector<int> count(len, 0);
+
+  // the region gets fewer threads than the partition was made for
+#pragma omp parallel num_threads(1)
+  {
+    int begin = 0;
+    int end = 0;
+    RAJA::policy::omp::numa::team_range(partition, len, begin, end);
+    for (int i = begin; i < end; ++i) {
+      ++count[i];
+    }
+  }
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(count[i], 1);
+  }
+}
+
+TEST(NumaUnitTest, FirstTouchFill)
+{
+  for (size_t len : {size_t(0), size_t(1), size_t(13), size_t(100003)}) {
+    std::vector<double> data(len, -1.0);
+    RAJA::numa_first_touch_fill(data.data(), len, 2.5);
+    for (size_t i = 0; i < len; ++i) {
+      ASSERT_EQ(data[i], 2.5);
+    }
+  }
+}
+
+TEST(NumaUnitTest, StaticExecSameThreadEveryLoop)
+{
+  const int len = 10007;
+  std::vector<int> first(len, -1);
+  std::vector<int> second(len, -1);
+  int* first_ptr = first.data();
+  int* second_ptr = second.data();
+
+  RAJA::forall<RAJA::omp_numa_static_exec>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      [=](int i) { first_ptr[i] = omp_get_thread_num(); });
+  RAJA::forall<RAJA::omp_numa_static_exec>(
+      RAJA::TypedRangeSegment<int>(0, len),
+      [=](int i) { second_ptr[i] = omp_get_thread_num(); });
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_NE(first[i], -1);
+    ASSERT_EQ(first[i], second[i]);
+  }
+}
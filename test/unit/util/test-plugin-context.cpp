@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the kernel information passed
+/// to plugins in PluginContext
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/PluginStrategy.hpp"
+
+#include <string>
+
+struct RecordedContext
+{
+  std::string kernel_name;
+  std::string policy_name;
+  uint64_t call_site_id = 0;
+  size_t num_iterations = 0;
+};
+
+static RecordedContext s_recorded;
+
+class RecordPlugin : public RAJA::util::PluginStrategy
+{
+public:
+  void preLaunch(const RAJA::util::PluginContext& p) override
+  {
+    s_recorded.kernel_name = p.kernel_name != nullptr ? p.kernel_name : "";
+    s_recorded.policy_name = p.policy_name;
+    s_recorded.call_site_id = p.call_site_id;
+    s_recorded.num_iterations = p.num_iterations;
+  }
+};
+
+static RAJA::util::PluginRegistry::add<RecordPlugin>
+    P("RecordContext", "Records the last plugin context.");
+
+
+TEST(PluginContextUnitTest, Active)
+{
+  EXPECT_TRUE(RAJA::util::plugins_active());
+}
+
+TEST(PluginContextUnitTest, Forall)
+{
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 10),
+                               RAJA::expt::KernelName("named_forall"),
+                               [=](int) {});
+
+  EXPECT_EQ(s_recorded.kernel_name, "named_forall");
+  EXPECT_NE(s_recorded.policy_name.find("seq_exec"), std::string::npos);
+  EXPECT_EQ(s_recorded.num_iterations, 10u);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 7),
+                               [=](int) {});
+
+  EXPECT_EQ(s_recorded.kernel_name, "");
+  EXPECT_EQ(s_recorded.num_iterations, 7u);
+}
+
+TEST(PluginContextUnitTest, CallSiteId)
+{
+  uint64_t ids[2];
+  for (int i = 0; i < 2; ++i) {
+    RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 4),
+                                 [=](int) {});
+    ids[i] = s_recorded.call_site_id;
+  }
+  EXPECT_EQ(ids[0], ids[1]);
+
+  RAJA::forall<RAJA::seq_exec>(RAJA::TypedRangeSegment<int>(0, 4),
+                               [=](int) {});
+  EXPECT_NE(s_recorded.call_site_id, ids[0]);
+}
+
+TEST(PluginContextUnitTest, Kernel)
+{
+  using POL = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::seq_exec,
+        RAJA::statement::For<0, RAJA::seq_exec,
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+
+  RAJA::kernel<POL>(RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, 3),
+                                     RAJA::TypedRangeSegment<int>(0, 5)),
+                    [=](int, int) {});
+
+  EXPECT_EQ(s_recorded.num_iterations, 15u);
+  EXPECT_NE(s_recorded.policy_name.find("seq_exec"), std::string::npos);
+}
+
+TEST(PluginContextUnitTest, Launch)
+{
+  using LAUNCH_POL = RAJA::LaunchPolicy<RAJA::seq_launch_t>;
+
+  RAJA::launch<LAUNCH_POL>(
+      RAJA::LaunchParams(RAJA::Teams(2, 3), RAJA::Threads(4)),
+      "named_launch",
+      [=](RAJA::LaunchContext) {});
+
+  EXPECT_EQ(s_recorded.kernel_name, "named_launch");
+  EXPECT_EQ(s_recorded.num_iterations, 24u);
+}
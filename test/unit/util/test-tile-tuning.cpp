@@ -0,0 +1,130 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-23, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for the tile size tuning database
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/TileTuning.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using RAJA::util::TileTuningDatabase;
+
+TEST(TileTuningUnitTest, Lookup)
+{
+  TileTuningDatabase db;
+  db.insert({"transpose", 4, {1024, 1024}, {64, 16}, 1.0});
+  db.insert({"transpose", 4, {64, 64}, {8, 8}, 1.0});
+  db.insert({"transpose", 4, {1024, 1024, 8}, {4, 4, 4}, 1.0});
+
+  TileTuningDatabase::Sizes tiles;
+  ASSERT_TRUE(db.lookup("transpose", {1024, 1024}, 4, tiles));
+  ASSERT_EQ(tiles, (TileTuningDatabase::Sizes{64, 16}));
+
+  // closest shape
+  tiles.clear();
+  ASSERT_TRUE(db.lookup("transpose", {2048, 512}, 4, tiles));
+  ASSERT_EQ(tiles, (TileTuningDatabase::Sizes{64, 16}));
+  tiles.clear();
+  ASSERT_TRUE(db.lookup("transpose", {100, 80}, 4, tiles));
+  ASSERT_EQ(tiles, (TileTuningDatabase::Sizes{8, 8}));
+
+  // number of tiles must match
+  tiles = TileTuningDatabase::Sizes(1);
+  ASSERT_FALSE(db.lookup("transpose", {1024, 1024}, 4, tiles));
+
+  tiles.clear();
+  ASSERT_FALSE(db.lookup("stencil", {1024, 1024}, 4, tiles));
+
+  // same key replaces the entry
+  db.insert({"transpose", 4, {1024, 1024}, {32, 32}, 0.5});
+  ASSERT_EQ(db.size(), 3u);
+  tiles.clear();
+  ASSERT_TRUE(db.lookup("transpose", {1024, 1024}, 4, tiles));
+  ASSERT_EQ(tiles, (TileTuningDatabase::Sizes{32, 32}));
+}
+
+TEST(TileTuningUnitTest, SaveLoad)
+{
+  const char* path = "test-tile-tuning.db";
+
+  TileTuningDatabase db;
+  db.insert({"transpose", 4, {1024, 1024}, {64, 16}, 0.25});
+  db.insert({"stencil", 16, {128, 128, 128}, {8, 8, 32}, 0.5});
+  ASSERT_TRUE(db.save(path));
+
+  TileTuningDatabase loaded;
+  ASSERT_TRUE(loaded.load(path));
+  ASSERT_EQ(loaded.size(), 2u);
+
+  TileTuningDatabase::Sizes tiles;
+  ASSERT_TRUE(loaded.lookup("stencil", {128, 128, 128}, 16, tiles));
+  ASSERT_EQ(tiles, (TileTuningDatabase::Sizes{8, 8, 32}));
+
+  {
+    std::ofstream out(path);
+    out << "# comment\n\ntranspose 4 1024x1024 64x16 0.25\nbad line\n";
+  }
+  TileTuningDatabase partial;
+  ASSERT_FALSE(partial.load(path));
+  ASSERT_EQ(partial.size(), 1u);
+
+  std::remove(path);
+}
+
+TEST(TileTuningUnitTest, Tune)
+{
+  auto& db = TileTuningDatabase::instance();
+  db.clear();
+
+  int calls = 0;
+  auto tiles = RAJA::util::tune_tile_sizes(
+      "tune_test", {256, 256},
+      std::array<TileTuningDatabase::Sizes, 2>{{{8, 16, 32}, {4, 8}}},
+      [&](camp::tuple<RAJA::TileSize, RAJA::TileSize> t) {
+        ++calls;
+        ASSERT_GT(camp::get<0>(t).size, 0);
+        ASSERT_GT(camp::get<1>(t).size, 0);
+      },
+      2);
+
+  // one warm up and two timed runs of each of the 6 combinations
+  ASSERT_EQ(calls, 18);
+  ASSERT_EQ(db.size(), 1u);
+
+  auto tuned = RAJA::util::tuned_tile_sizes("tune_test", {256, 256}, 1, 1);
+  ASSERT_EQ(camp::get<0>(tuned).size, camp::get<0>(tiles).size);
+  ASSERT_EQ(camp::get<1>(tuned).size, camp::get<1>(tiles).size);
+
+  auto defaults = RAJA::util::tuned_tile_sizes("untuned", {256, 256}, 12, 3);
+  ASSERT_EQ(camp::get<0>(defaults).size, 12);
+  ASSERT_EQ(camp::get<1>(defaults).size, 3);
+
+  db.clear();
+}
+
+TEST(TileTuningUnitTest, TuneNeedsRepeats)
+{
+  auto& db = TileTuningDatabase::instance();
+  db.clear();
+
+  int calls = 0;
+  auto run = [&](camp::tuple<RAJA::TileSize>) { ++calls; };
+  const std::array<TileTuningDatabase::Sizes, 1> candidates{{{8, 16}}};
+
+  ASSERT_ANY_THROW(RAJA::util::tune_tile_sizes(
+      "no_repeats", {64}, candidates, run, 0));
+  ASSERT_ANY_THROW(RAJA::util::tune_tile_sizes(
+      "no_repeats", {64}, candidates, run, -1));
+
+  ASSERT_EQ(calls, 0);
+  ASSERT_EQ(db.size(), 0u);
+}
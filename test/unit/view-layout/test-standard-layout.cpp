@@ -175,3 +175,44 @@ TEST(LayoutUnitTest, 2D_IJ_ProjJ)
   }
 }
 
+
+TEST(LayoutUnitTest, LargeToIndices)
+{
+  using my_layout = RAJA::Layout<3, RAJA::Index_type>;
+
+  // sizes that are not powers of 2 and a linear space beyond 32 bits
+  const my_layout layout(1021, 4099, 1543);
+
+  const RAJA::Index_type lins[] = {0, 1, 1542, 1543, 6324757,
+                                   6324757 * 517 + 4000 * 1543 + 7,
+                                   layout.size() - 1};
+  for (RAJA::Index_type lin : lins) {
+    RAJA::Index_type i, j, k;
+    layout.toIndices(lin, i, j, k);
+
+    ASSERT_EQ(i, lin / (4099 * 1543));
+    ASSERT_EQ(j, (lin / 1543) % 4099);
+    ASSERT_EQ(k, lin % 1543);
+    ASSERT_EQ(lin, layout(i, j, k));
+  }
+}
+
+TEST(StaticLayoutUnitTest, 2D_toIndices)
+{
+  using my_layout = RAJA::StaticLayout<RAJA::PERM_JI, 3, 5>;
+
+  // Check that we get the identity
+  for (int k = 0; k < 15; ++k) {
+
+    // inverse map
+    int i, j;
+    my_layout::s_toIndices(k, i, j);
+
+    // forward map
+    int k2 = my_layout::s_oper(i, j);
+
+    ASSERT_EQ(k, k2);
+    ASSERT_EQ(i, k % 3);
+    ASSERT_EQ(j, k / 3);
+  }
+}